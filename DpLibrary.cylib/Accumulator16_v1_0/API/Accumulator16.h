@@ -16,12 +16,26 @@
 #include "cyfitter.h"
 #include "cytypes.h"
 
+// Rounded mean of 2^MEAN_SHIFT items, 0 when disabled
+#define `$INSTANCE_NAME`_MEAN_SHIFT (`$MeanShift`u)
+
+// Signed sum and mean, no threshold then
+#define `$INSTANCE_NAME`_INPUT_SIGNED (`$InputSigned`u)
+
+// Sums pushed into the F1 result FIFO, 0 when disabled
+#define `$INSTANCE_NAME`_RESULT_FIFO (`$ResultFifo`u)
+
 //**************************************************************
 //  Function Prototypes
 //**************************************************************
 void `$INSTANCE_NAME`_WriteValue(uint16 value);
 uint16 `$INSTANCE_NAME`_ReadAccumulator(void);
 void `$INSTANCE_NAME`_ClearAccumulator(void);
+uint16 `$INSTANCE_NAME`_ReadMean(void);
+uint16 `$INSTANCE_NAME`_ReadResult(void);
+#if (`$INSTANCE_NAME`_INPUT_SIGNED == 0u)
+void `$INSTANCE_NAME`_SetThreshold(uint16 value);
+#endif
 
 //**************************************************************
 //  Registers
@@ -30,6 +44,15 @@ void `$INSTANCE_NAME`_ClearAccumulator(void);
 #define `$INSTANCE_NAME`_INPUT_PTR (  (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_F0_REG)
 #define `$INSTANCE_NAME`_ACCUMULATOR_REG (* (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_A0_REG)
 #define `$INSTANCE_NAME`_ACCUMULATOR_PTR (  (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_MEAN_REG (* (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_A1_REG)
+#define `$INSTANCE_NAME`_MEAN_PTR (  (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_A1_REG)
+#define `$INSTANCE_NAME`_RESULT_REG (* (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_F1_REG)
+#define `$INSTANCE_NAME`_RESULT_PTR (  (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_F1_REG)
+// D1 is compared as unsigned, so no threshold with INPUT_SIGNED
+#if (`$INSTANCE_NAME`_INPUT_SIGNED == 0u)
+#define `$INSTANCE_NAME`_THRESHOLD_REG (* (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_D1_REG)
+#define `$INSTANCE_NAME`_THRESHOLD_PTR (  (reg16 *) `$INSTANCE_NAME`_dp_u0__16BIT_D1_REG)
+#endif
 
 #endif  // ACCUMULATOR16_`$INSTANCE_NAME`_H
 /* [] END OF FILE */
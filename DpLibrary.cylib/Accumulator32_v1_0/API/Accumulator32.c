@@ -12,8 +12,15 @@
 
 #include "`$INSTANCE_NAME`.h"
 
+// Only INPUT_WIDTH bits of the value are written
 void `$INSTANCE_NAME`_WriteValue(uint32 value) {
+#if (`$INSTANCE_NAME`_INPUT_WIDTH == 8u)
+    `$INSTANCE_NAME`_INPUT_REG = (uint8)value;
+#elif (`$INSTANCE_NAME`_INPUT_WIDTH == 16u)
+    `$INSTANCE_NAME`_INPUT_REG = (uint16)value;
+#else
     `$INSTANCE_NAME`_INPUT_REG = value;
+#endif
 }
 
 uint32 `$INSTANCE_NAME`_ReadAccumulator(void) {
@@ -22,6 +29,26 @@ uint32 `$INSTANCE_NAME`_ReadAccumulator(void) {
 
 void `$INSTANCE_NAME`_ClearAccumulator(void) {
     `$INSTANCE_NAME`_ACCUMULATOR_REG = 0u;
+#if (`$INSTANCE_NAME`_MEAN_SHIFT > 0u)
+    `$INSTANCE_NAME`_MEAN_REG = 0u;
+#endif
 }
 
+// Valid after BUSY falls
+uint32 `$INSTANCE_NAME`_ReadMean(void) {
+    return `$INSTANCE_NAME`_MEAN_REG;
+}
+
+// Oldest sum in the result FIFO, valid while it is not empty
+uint32 `$INSTANCE_NAME`_ReadResult(void) {
+    return `$INSTANCE_NAME`_RESULT_REG;
+}
+
+#if (`$INSTANCE_NAME`_INPUT_SIGNED == 0u)
+// OVER_THRESHOLD is HIGH while the sum is above the value
+void `$INSTANCE_NAME`_SetThreshold(uint32 value) {
+    `$INSTANCE_NAME`_THRESHOLD_REG = value;
+}
+#endif
+
 /* [] END OF FILE */
@@ -16,20 +16,52 @@
 #include "cyfitter.h"
 #include "cytypes.h"
 
+// Rounded mean of 2^MEAN_SHIFT items, 0 when disabled
+#define `$INSTANCE_NAME`_MEAN_SHIFT (`$MeanShift`u)
+
+// Bits of a sample written into INPUT, extended to 32 bits
+#define `$INSTANCE_NAME`_INPUT_WIDTH (`$InputWidth`u)
+#define `$INSTANCE_NAME`_INPUT_SIGNED (`$InputSigned`u)
+
+// Sums pushed into the F1 result FIFO, 0 when disabled
+#define `$INSTANCE_NAME`_RESULT_FIFO (`$ResultFifo`u)
+
 //**************************************************************
 //  Function Prototypes
 //**************************************************************
 void `$INSTANCE_NAME`_WriteValue(uint32 value);
 uint32 `$INSTANCE_NAME`_ReadAccumulator(void);
 void `$INSTANCE_NAME`_ClearAccumulator(void);
+uint32 `$INSTANCE_NAME`_ReadMean(void);
+uint32 `$INSTANCE_NAME`_ReadResult(void);
+#if (`$INSTANCE_NAME`_INPUT_SIGNED == 0u)
+void `$INSTANCE_NAME`_SetThreshold(uint32 value);
+#endif
 
 //**************************************************************
 //  Registers
 //**************************************************************
+#if (`$INSTANCE_NAME`_INPUT_WIDTH == 8u)
+#define `$INSTANCE_NAME`_INPUT_REG (* (reg8 *) `$INSTANCE_NAME`_dp_u0__F0_REG)
+#define `$INSTANCE_NAME`_INPUT_PTR (  (reg8 *) `$INSTANCE_NAME`_dp_u0__F0_REG)
+#elif (`$INSTANCE_NAME`_INPUT_WIDTH == 16u)
+#define `$INSTANCE_NAME`_INPUT_REG (* (reg16 *) `$INSTANCE_NAME`_dp_u0__F0_REG)
+#define `$INSTANCE_NAME`_INPUT_PTR (  (reg16 *) `$INSTANCE_NAME`_dp_u0__F0_REG)
+#else
 #define `$INSTANCE_NAME`_INPUT_REG (* (reg32 *) `$INSTANCE_NAME`_dp_u0__F0_REG)
 #define `$INSTANCE_NAME`_INPUT_PTR (  (reg32 *) `$INSTANCE_NAME`_dp_u0__F0_REG)
+#endif
 #define `$INSTANCE_NAME`_ACCUMULATOR_REG (* (reg32 *) `$INSTANCE_NAME`_dp_u0__A0_REG)
 #define `$INSTANCE_NAME`_ACCUMULATOR_PTR (  (reg32 *) `$INSTANCE_NAME`_dp_u0__A0_REG)
+#define `$INSTANCE_NAME`_MEAN_REG (* (reg32 *) `$INSTANCE_NAME`_dp_u0__A1_REG)
+#define `$INSTANCE_NAME`_MEAN_PTR (  (reg32 *) `$INSTANCE_NAME`_dp_u0__A1_REG)
+#define `$INSTANCE_NAME`_RESULT_REG (* (reg32 *) `$INSTANCE_NAME`_dp_u0__F1_REG)
+#define `$INSTANCE_NAME`_RESULT_PTR (  (reg32 *) `$INSTANCE_NAME`_dp_u0__F1_REG)
+// D1 is compared as unsigned, so no threshold with INPUT_SIGNED
+#if (`$INSTANCE_NAME`_INPUT_SIGNED == 0u)
+#define `$INSTANCE_NAME`_THRESHOLD_REG (* (reg32 *) `$INSTANCE_NAME`_dp_u0__D1_REG)
+#define `$INSTANCE_NAME`_THRESHOLD_PTR (  (reg32 *) `$INSTANCE_NAME`_dp_u0__D1_REG)
+#endif
 
 #endif  // ACCUMULATOR32_`$INSTANCE_NAME`_H
 /* [] END OF FILE */
@@ -22,6 +22,26 @@ uint8 `$INSTANCE_NAME`_ReadAccumulator(void) {
 
 void `$INSTANCE_NAME`_ClearAccumulator(void) {
     `$INSTANCE_NAME`_ACCUMULATOR_REG = 0u;
+#if (`$INSTANCE_NAME`_MEAN_SHIFT > 0u)
+    `$INSTANCE_NAME`_MEAN_REG = 0u;
+#endif
 }
 
+// Valid after BUSY falls
+uint8 `$INSTANCE_NAME`_ReadMean(void) {
+    return `$INSTANCE_NAME`_MEAN_REG;
+}
+
+// Oldest sum in the result FIFO, valid while it is not empty
+uint8 `$INSTANCE_NAME`_ReadResult(void) {
+    return `$INSTANCE_NAME`_RESULT_REG;
+}
+
+#if (`$INSTANCE_NAME`_INPUT_SIGNED == 0u)
+// OVER_THRESHOLD is HIGH while the sum is above the value
+void `$INSTANCE_NAME`_SetThreshold(uint8 value) {
+    `$INSTANCE_NAME`_THRESHOLD_REG = value;
+}
+#endif
+
 /* [] END OF FILE */
@@ -12,41 +12,92 @@
 // ========================================
 `include "cypress.v"
 //`#end` -- edit above this line, do not edit this line
-// Generated on 06/27/2019 at 21:37
+// Generated on 10/19/2026 at 12:09
 // Component: Accumulator8_v1_0
 module Accumulator8_v1_0 (
+	output  busy,
+	output  done,
 	output  dreq,
-    output  busy,
+	output  over_threshold,
 	input   clock,
 	input   reset
 );
+	parameter InputSigned = 0;
+	parameter MeanShift = 0;
+	parameter ResultFifo = 0;
 
 //`#start body` -- edit after this line, do not edit this line
 
+// Rounded mean of the sum for 2^MeanShift items
+//   A1 <= (A0 + 2^(MeanShift-1)) >> MeanShift
+// It is calculated in A1 by the shifter when the FIFO is drained,
+// before BUSY falls.  0 disables it, up to 7.
+// COPY shifts A0 left into A1 to take its MSB from SO, and the
+// first SHIFT shifts it back.  The shifts are arithmetic with
+// InputSigned=1 and logical otherwise, with the top bit given on
+// ROUTE_SI.  ROUND adds 1 and keeps the carry out, which the last
+// SHIFT shifts in, so the rounding of the largest sum does not
+// wrap.  The mean takes MeanShift+3 clocks.
+
+// Result FIFO
+// With ResultFifo=1 the sum in A0 is pushed into F1 when the FIFO
+// is drained, and DONE is HIGH for that clock.  DONE may capture
+// a timestamp, and F1 keeps up to four results for the CPU or a
+// DMA.  BUSY falls a clock later.
+
+// Threshold
+// OVER_THRESHOLD is HIGH while the unsigned sum in A0 is above D1.
+// The compare is unsigned, so it stays LOW with InputSigned=1.
+// It is the Compare 1 output, so it rises in the clock the sum
+// crosses the threshold without any read by the CPU.  D1 is all
+// ones after reset, so it stays LOW until a threshold is set.
+
+// Signed sum: the sign is shifted into the mean, and no threshold
+localparam      SIGNED_SUM = (InputSigned != 0);
+
 // State code declaration
-localparam      ST_IDLE = 2'b00;
-localparam      ST_GET  = 2'b01;
-localparam      ST_ADD  = 2'b11;
+localparam      ST_IDLE  = 3'b000;
+localparam      ST_GET   = 3'b001;
+localparam      ST_ADD   = 3'b011;
+localparam      ST_COPY  = 3'b100;
+localparam      ST_SHIFT = 3'b101;
+localparam      ST_ROUND = 3'b111;
+localparam      ST_DONE  = 3'b010;
 
 // Datapath function declaration
-localparam      CS_IDLE = 3'b000;
-localparam      CS_ADD  = 3'b001;
+localparam      CS_IDLE  = 3'b000;
+localparam      CS_ADD   = 3'b001;
+localparam      CS_COPY  = 3'b010;
+localparam      CS_SHIFT = 3'b011;
+localparam      CS_ROUND = 3'b100;
 
 // Wire declaration
-wire[1:0]       state;          // State code
+wire[2:0]       state;          // State code
 wire            f0_empty;       // F0 is EMPTY
 wire            f0_not_full;    // F0 is NOT FULL
+wire            ce1;            // A0 is equal to D1
+wire            cl1;            // A0 is less than D1
+wire            so_msb;         // MSB shifted out of A0
+wire            co_msb;         // Carry out of ROUND
+wire            route_si;       // Top bit shifted into A1
 
 // Pseudo register
 reg[2:0]        addr;           // Datapath function
 reg             d0_load;        // LOAD FIFO into D0
+reg             f1_load;        // Push A0 into F1
 reg             busy_reg;       // BUSY output flag
 
 // State machine behavior
-reg [1:0]       state_reg;
+reg [2:0]       state_reg;
+reg [3:0]       count_reg;      // Shifts left before ROUND
+reg             sign_reg;       // MSB of A0 at COPY
+reg             carry_reg;      // Carry out of ROUND
 always @(posedge clock or posedge reset) begin
     if (reset) begin
         state_reg <= ST_IDLE;
+        count_reg <= 4'd0;
+        sign_reg <= 1'b0;
+        carry_reg <= 1'b0;
     end else casez(state)
         ST_IDLE: begin      // Wait for FIFO not empty
             if (~f0_empty) begin
@@ -59,10 +110,40 @@ always @(posedge clock or posedge reset) begin
         ST_ADD: begin       // Add D0 into A0
             if (~f0_empty) begin
                 state_reg <= ST_GET;
+            end else if (MeanShift != 0) begin
+                state_reg <= ST_COPY;
+            end else if (ResultFifo != 0) begin
+                state_reg <= ST_DONE;
             end else begin
                 state_reg <= ST_IDLE;
             end
         end
+        ST_COPY: begin      // Shift A0 left into A1
+            count_reg <= MeanShift;
+            sign_reg <= so_msb;
+            state_reg <= ST_SHIFT;
+        end
+        ST_SHIFT: begin     // Shift A1 right
+            if (count_reg == 4'd0) begin
+                if (ResultFifo != 0) begin
+                    state_reg <= ST_DONE;
+                end else begin
+                    state_reg <= ST_IDLE;
+                end
+            end else begin
+                count_reg <= count_reg - 4'd1;
+                if (count_reg == 4'd1) begin
+                    state_reg <= ST_ROUND;
+                end
+            end
+        end
+        ST_ROUND: begin     // Add the last bit out
+            carry_reg <= co_msb;
+            state_reg <= ST_SHIFT;
+        end
+        ST_DONE: begin      // Push A0 into F1
+            state_reg <= ST_IDLE;
+        end
         default: begin      // Unidentified state
             state_reg <= ST_IDLE;
         end
@@ -72,6 +153,7 @@ assign          state = state_reg;
 
 // Internal control signals
 always @(state) begin
+    f1_load = 1'b0;
     casez (state)
         ST_IDLE: begin
             addr = CS_IDLE;
@@ -88,6 +170,27 @@ always @(state) begin
             d0_load = 1'b0;
             busy_reg = 1'b1;
         end
+        ST_COPY: begin
+            addr = CS_COPY;
+            d0_load = 1'b0;
+            busy_reg = 1'b1;
+        end
+        ST_SHIFT: begin
+            addr = CS_SHIFT;
+            d0_load = 1'b0;
+            busy_reg = 1'b1;
+        end
+        ST_ROUND: begin
+            addr = CS_ROUND;
+            d0_load = 1'b0;
+            busy_reg = 1'b1;
+        end
+        ST_DONE: begin
+            addr = CS_IDLE;
+            d0_load = 1'b0;
+            f1_load = 1'b1;
+            busy_reg = 1'b1;
+        end
         default: begin
             addr = CS_IDLE;
             d0_load = 1'b0;
@@ -102,8 +205,20 @@ assign      dreq = f0_not_full;
 // BUSY status flag
 assign      busy = busy_reg;
 
+// Result pushed into F1
+assign      done = (state == ST_DONE);
+
+// Top bit shifted into A1: the MSB of A0 back in the first SHIFT,
+// the sign or 0 in the next ones, and the carry of ROUND in the last
+assign      route_si = (count_reg == MeanShift) ? sign_reg
+                     : (count_reg == 4'd0) ? (SIGNED_SUM & sign_reg) ^ carry_reg
+                     : (SIGNED_SUM & sign_reg);
 
-cy_psoc3_dp8 #(.cy_dpconfig_a(
+// Sum above the threshold, unsigned only
+assign      over_threshold = (SIGNED_SUM) ? 1'b0 : (~ce1 & ~cl1);
+
+
+cy_psoc3_dp8 #(.cy_d1_init_a(8'hFF), .cy_dpconfig_a(
 {
     `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
     `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
@@ -114,17 +229,17 @@ cy_psoc3_dp8 #(.cy_dpconfig_a(
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
     `CS_CMP_SEL_CFGA, /*CFGRAM1: ADD: A0 <= A0 + D0*/
     `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
-    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
-    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
-    `CS_CMP_SEL_CFGA, /*CFGRAM2: */
-    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
-    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_SHFT_OP___SL, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
-    `CS_CMP_SEL_CFGA, /*CFGRAM3: */
-    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
-    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: COPY: A1 <= A0 << 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP___SR, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGB,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3: SHIFT: A1 <= A1 >> 1, top bit on ROUTE_SI*/
+    `CS_ALU_OP__INC, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
-    `CS_CMP_SEL_CFGA, /*CFGRAM4: */
+    `CS_CMP_SEL_CFGA, /*CFGRAM4: ROUND: A1 <= A1 + 1*/
     `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
     `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
@@ -139,12 +254,12 @@ cy_psoc3_dp8 #(.cy_dpconfig_a(
     `CS_CMP_SEL_CFGA, /*CFGRAM7: */
     8'hFF, 8'h00,  /*CFG9: */
     8'hFF, 8'hFF,  /*CFG11-10: */
-    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CMPB_A1_D1, `SC_CMPA_A0_D1, `SC_CI_B_ARITH,
     `SC_CI_A_ARITH, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
-    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_ROUTE,
     `SC_SI_A_DEFSI, /*CFG13-12: */
     `SC_A0_SRC_ACC, `SC_SHIFT_SL, 1'h0,
-    1'h0, `SC_FIFO1_BUS, `SC_FIFO0_BUS,
+    1'h0, `SC_FIFO1_ALU, `SC_FIFO0_BUS,
     `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_NOCHN,
     `SC_FB_NOCHN, `SC_CMP1_NOCHN,
     `SC_CMP0_NOCHN, /*CFG15-14: */
@@ -156,24 +271,24 @@ cy_psoc3_dp8 #(.cy_dpconfig_a(
         /*  input                   */  .reset(reset),
         /*  input                   */  .clk(clock),
         /*  input   [02:00]         */  .cs_addr(addr),
-        /*  input                   */  .route_si(1'b0),
+        /*  input                   */  .route_si(route_si),
         /*  input                   */  .route_ci(1'b0),
         /*  input                   */  .f0_load(1'b0),
-        /*  input                   */  .f1_load(1'b0),
+        /*  input                   */  .f1_load(f1_load),
         /*  input                   */  .d0_load(d0_load),
         /*  input                   */  .d1_load(1'b0),
         /*  output                  */  .ce0(),
         /*  output                  */  .cl0(),
         /*  output                  */  .z0(),
         /*  output                  */  .ff0(),
-        /*  output                  */  .ce1(),
-        /*  output                  */  .cl1(),
+        /*  output                  */  .ce1(ce1),
+        /*  output                  */  .cl1(cl1),
         /*  output                  */  .z1(),
         /*  output                  */  .ff1(),
         /*  output                  */  .ov_msb(),
-        /*  output                  */  .co_msb(),
+        /*  output                  */  .co_msb(co_msb),
         /*  output                  */  .cmsb(),
-        /*  output                  */  .so(),
+        /*  output                  */  .so(so_msb),
         /*  output                  */  .f0_bus_stat(f0_not_full),
         /*  output                  */  .f0_blk_stat(f0_empty),
         /*  output                  */  .f1_bus_stat(),
@@ -0,0 +1,39 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+// Only WIDTH bits of the value are sent
+void `$INSTANCE_NAME`_WriteValue(uint32 value) {
+#if (`$INSTANCE_NAME`_WIDTH == 8u)
+    `$INSTANCE_NAME`_INPUT_REG = (uint8)value;
+#elif (`$INSTANCE_NAME`_WIDTH == 16u)
+    `$INSTANCE_NAME`_INPUT_REG = (uint16)value;
+#else
+    `$INSTANCE_NAME`_INPUT_REG = value;
+#endif
+}
+
+// A prefix character of 0 is not sent.
+// Takes effect from the next word written while the formatter
+// is idle.
+void `$INSTANCE_NAME`_SetPrefix(char8 prefix0, char8 prefix1) {
+    `$INSTANCE_NAME`_PREFIX0_REG = (uint8)prefix0;
+    `$INSTANCE_NAME`_PREFIX1_REG = (uint8)prefix1;
+}
+
+// Oldest character in OUTPUT, valid while READY is HIGH
+char8 `$INSTANCE_NAME`_ReadChar(void) {
+    return (char8)`$INSTANCE_NAME`_OUTPUT_REG;
+}
+
+/* [] END OF FILE */
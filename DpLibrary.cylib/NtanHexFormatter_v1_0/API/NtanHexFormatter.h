@@ -0,0 +1,79 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANHEXFORMATTER_`$INSTANCE_NAME`_H)
+#define NTANHEXFORMATTER_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+#define `$INSTANCE_NAME`_WIDTH      (`$Width`u)
+#define `$INSTANCE_NAME`_DECIMAL    (`$Decimal`u)
+
+// Digits of a line, with leading zeros in decimal
+#if (`$INSTANCE_NAME`_DECIMAL == 0u)
+#define `$INSTANCE_NAME`_DIGITS     (`$INSTANCE_NAME`_WIDTH / 4u)
+#elif (`$INSTANCE_NAME`_WIDTH == 8u)
+#define `$INSTANCE_NAME`_DIGITS     (3u)
+#elif (`$INSTANCE_NAME`_WIDTH == 16u)
+#define `$INSTANCE_NAME`_DIGITS     (5u)
+#else
+#define `$INSTANCE_NAME`_DIGITS     (10u)
+#endif
+
+#define `$INSTANCE_NAME`_TERMINATOR (`$Terminator`u)
+
+#define `$INSTANCE_NAME`_TERM_NONE  (0u)
+#define `$INSTANCE_NAME`_TERM_CRLF  (1u)
+#define `$INSTANCE_NAME`_TERM_LF    (2u)
+#define `$INSTANCE_NAME`_TERM_CR    (3u)
+
+// Characters of a line after the prefix
+#if (`$INSTANCE_NAME`_TERMINATOR == `$INSTANCE_NAME`_TERM_CRLF)
+#define `$INSTANCE_NAME`_LINE_LENGTH (`$INSTANCE_NAME`_DIGITS + 2u)
+#elif (`$INSTANCE_NAME`_TERMINATOR == `$INSTANCE_NAME`_TERM_NONE)
+#define `$INSTANCE_NAME`_LINE_LENGTH (`$INSTANCE_NAME`_DIGITS)
+#else
+#define `$INSTANCE_NAME`_LINE_LENGTH (`$INSTANCE_NAME`_DIGITS + 1u)
+#endif
+
+// A word is written into INPUT by the CPU or by a DMA on DREQ,
+// for example from the ACCUMULATOR_PTR of an Accumulator.
+// The characters are read from OUTPUT by a DMA on TX_REQ into
+// the INPUT_PTR of an NtanUartTx.  Both are peripheral to
+// peripheral transfers and share the upper address.
+
+#if (`$INSTANCE_NAME`_WIDTH == 8u)
+#define `$INSTANCE_NAME`_INPUT_REG (* (reg8 *)`$INSTANCE_NAME`_sW8_dp__F0_REG)
+#define `$INSTANCE_NAME`_INPUT_PTR (  (reg8 *)`$INSTANCE_NAME`_sW8_dp__F0_REG)
+#define `$INSTANCE_NAME`_PREFIX0_REG (* (reg8 *)`$INSTANCE_NAME`_sW8_dp__D0_REG)
+#define `$INSTANCE_NAME`_PREFIX1_REG (* (reg8 *)`$INSTANCE_NAME`_sW8_dp__D1_REG)
+#elif (`$INSTANCE_NAME`_WIDTH == 16u)
+#define `$INSTANCE_NAME`_INPUT_REG (* (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_F0_REG)
+#define `$INSTANCE_NAME`_INPUT_PTR (  (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_F0_REG)
+#define `$INSTANCE_NAME`_PREFIX0_REG (* (reg8 *)`$INSTANCE_NAME`_sW16_dp_u1__D0_REG)
+#define `$INSTANCE_NAME`_PREFIX1_REG (* (reg8 *)`$INSTANCE_NAME`_sW16_dp_u1__D1_REG)
+#else
+#define `$INSTANCE_NAME`_INPUT_REG (* (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__F0_REG)
+#define `$INSTANCE_NAME`_INPUT_PTR (  (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__F0_REG)
+#define `$INSTANCE_NAME`_PREFIX0_REG (* (reg8 *)`$INSTANCE_NAME`_sW32_dp_u3__D0_REG)
+#define `$INSTANCE_NAME`_PREFIX1_REG (* (reg8 *)`$INSTANCE_NAME`_sW32_dp_u3__D1_REG)
+#endif
+#define `$INSTANCE_NAME`_OUTPUT_REG (* (reg8 *)`$INSTANCE_NAME`_chr__F0_REG)
+#define `$INSTANCE_NAME`_OUTPUT_PTR (  (reg8 *)`$INSTANCE_NAME`_chr__F0_REG)
+
+extern void `$INSTANCE_NAME`_WriteValue(uint32 value);
+extern void `$INSTANCE_NAME`_SetPrefix(char8 prefix0, char8 prefix1);
+extern char8 `$INSTANCE_NAME`_ReadChar(void);
+
+#endif // NTANHEXFORMATTER_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
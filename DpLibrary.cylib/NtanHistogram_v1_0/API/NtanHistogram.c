@@ -0,0 +1,38 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+void `$INSTANCE_NAME`_WriteValue(uint8 value) {
+    `$INSTANCE_NAME`_INPUT_REG = value;
+}
+
+// Valid after BUSY falls, 0 for a bin out of range
+uint16 `$INSTANCE_NAME`_ReadBin(uint8 bin) {
+    switch (bin) {
+    case 0u: return `$INSTANCE_NAME`_BIN0_REG;
+    case 1u: return `$INSTANCE_NAME`_BIN1_REG;
+    case 2u: return `$INSTANCE_NAME`_BIN2_REG;
+    case 3u: return `$INSTANCE_NAME`_BIN3_REG;
+    default: return 0u;
+    }
+}
+
+// Call while BUSY is LOW
+void `$INSTANCE_NAME`_ClearBins(void) {
+    `$INSTANCE_NAME`_BIN0_REG = 0u;
+    `$INSTANCE_NAME`_BIN1_REG = 0u;
+    `$INSTANCE_NAME`_BIN2_REG = 0u;
+    `$INSTANCE_NAME`_BIN3_REG = 0u;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,49 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANHISTOGRAM_`$INSTANCE_NAME`_H)
+#define NTANHISTOGRAM_`$INSTANCE_NAME`_H
+
+#include "cyfitter.h"
+#include "cytypes.h"
+
+// Four bin histogram of 8-bit samples written into INPUT
+// A DMA channel on DREQ feeds a sample buffer with no CPU
+// cycle per sample.  Bins are read after BUSY falls.
+// A bin stays at 0xFFFF once it is full.
+
+#define `$INSTANCE_NAME`_BINS       (4u)
+#define `$INSTANCE_NAME`_BIN_SHIFT  (`$BinShift`u)
+
+//**************************************************************
+//  Function Prototypes
+//**************************************************************
+void `$INSTANCE_NAME`_WriteValue(uint8 value);
+uint16 `$INSTANCE_NAME`_ReadBin(uint8 bin);
+void `$INSTANCE_NAME`_ClearBins(void);
+
+//**************************************************************
+//  Registers
+//**************************************************************
+#define `$INSTANCE_NAME`_INPUT_REG (* (reg8 *) `$INSTANCE_NAME`_idx_u0__F0_REG)
+#define `$INSTANCE_NAME`_INPUT_PTR (  (reg8 *) `$INSTANCE_NAME`_idx_u0__F0_REG)
+#define `$INSTANCE_NAME`_BIN0_REG (* (reg16 *) `$INSTANCE_NAME`_cnt01_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_BIN0_PTR (  (reg16 *) `$INSTANCE_NAME`_cnt01_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_BIN1_REG (* (reg16 *) `$INSTANCE_NAME`_cnt01_u0__16BIT_A1_REG)
+#define `$INSTANCE_NAME`_BIN1_PTR (  (reg16 *) `$INSTANCE_NAME`_cnt01_u0__16BIT_A1_REG)
+#define `$INSTANCE_NAME`_BIN2_REG (* (reg16 *) `$INSTANCE_NAME`_cnt23_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_BIN2_PTR (  (reg16 *) `$INSTANCE_NAME`_cnt23_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_BIN3_REG (* (reg16 *) `$INSTANCE_NAME`_cnt23_u0__16BIT_A1_REG)
+#define `$INSTANCE_NAME`_BIN3_PTR (  (reg16 *) `$INSTANCE_NAME`_cnt23_u0__16BIT_A1_REG)
+
+#endif  // NTANHISTOGRAM_`$INSTANCE_NAME`_H
+/* [] END OF FILE */
@@ -0,0 +1,513 @@
+
+//`#start header` -- edit after this line, do not edit this line
+// ========================================
+//
+// Copyright YOUR COMPANY, THE YEAR
+// All Rights Reserved
+// UNPUBLISHED, LICENSED SOFTWARE.
+//
+// CONFIDENTIAL AND PROPRIETARY INFORMATION
+// WHICH IS THE PROPERTY OF your company.
+//
+// ========================================
+`include "cypress.v"
+//`#end` -- edit above this line, do not edit this line
+// Generated on 10/19/2026 at 11:44
+// Component: NtanHistogram_v1_0
+module NtanHistogram_v1_0 (
+	output  busy,
+	output  dreq,
+	input   clock,
+	input   reset
+);
+	parameter BinShift = 0;
+
+//`#start body` -- edit after this line, do not edit this line
+
+// Four bin histogram of 8-bit samples written into F0
+//   bin = sample[7-BinShift:6-BinShift]
+// A sample with any bit above the bin index set is clamped
+// into bin 3.  BinShift=0 makes four bins of 64 over 0..255,
+// and BinShift=2 makes bins of 16 over 0..63.  Up to 6.
+// The bins are 16-bit counters in A0 and A1 of the cnt01 and
+// cnt23 datapaths.  A sample takes 3+BinShift clocks.
+// A bin saturates at 0xFFFF: the 0xFF detect chained over both
+// slices blocks the increment of a full counter.
+
+// State code declaration
+localparam      ST_IDLE  = 3'b000;
+localparam      ST_LOAD  = 3'b001;
+localparam      ST_SKIP  = 3'b011;
+localparam      ST_BIT1  = 3'b010;
+localparam      ST_BIT0  = 3'b110;
+localparam      ST_COUNT = 3'b100;
+
+// Datapath function declaration
+localparam      CS_IDLE  = 3'b000;
+localparam      CS_LOAD  = 3'b001;  // idx: A0 <= F0
+localparam      CS_SHIFT = 3'b010;  // idx: A0 <= A0 << 1
+localparam      CS_INC0  = 3'b001;  // cnt: A0 <= A0 + 1
+localparam      CS_INC1  = 3'b010;  // cnt: A1 <= A1 + 1
+
+// Wire declaration
+wire[2:0]       state;          // State code
+wire            f0_empty;       // F0 is EMPTY
+wire            f0_not_full;    // F0 is NOT FULL
+wire            shift_out;      // MSB shifted out of the sample
+wire[1:0]       bin;            // Bin to be counted
+wire[1:0]       ff01_0;         // BIN0 is 0xFF per slice, [1] for 16 bits
+wire[1:0]       ff01_1;         // BIN1 is 0xFF per slice
+wire[1:0]       ff23_0;         // BIN2 is 0xFF per slice
+wire[1:0]       ff23_1;         // BIN3 is 0xFF per slice
+
+// Pseudo register
+reg[2:0]        idx_addr;       // Datapath function of idx
+reg[2:0]        cnt01_addr;     // Datapath function of cnt01
+reg[2:0]        cnt23_addr;     // Datapath function of cnt23
+reg             busy_reg;       // BUSY output flag
+
+// State machine behavior
+reg [2:0]       state_reg;
+reg [2:0]       count_reg;      // Bits left to be skipped
+reg             clamp_reg;      // A skipped bit was HIGH
+reg [1:0]       bin_reg;        // Bin index shifted out
+always @(posedge clock or posedge reset) begin
+    if (reset) begin
+        state_reg <= ST_IDLE;
+        count_reg <= 3'd0;
+        clamp_reg <= 1'b0;
+        bin_reg <= 2'b00;
+    end else casez(state)
+        ST_IDLE: begin      // Wait for FIFO not empty
+            if (~f0_empty) begin
+                state_reg <= ST_LOAD;
+            end
+        end
+        ST_COUNT,
+        ST_LOAD: begin      // Pull FIFO into A0
+            count_reg <= BinShift;
+            clamp_reg <= 1'b0;
+            if (state == ST_COUNT && f0_empty) begin
+                state_reg <= ST_IDLE;
+            end else if (BinShift == 0) begin
+                state_reg <= ST_BIT1;
+            end else begin
+                state_reg <= ST_SKIP;
+            end
+        end
+        ST_SKIP: begin      // Shift out a bit above the bin index
+            count_reg <= count_reg - 3'd1;
+            clamp_reg <= clamp_reg | shift_out;
+            if (count_reg == 3'd1) begin
+                state_reg <= ST_BIT1;
+            end
+        end
+        ST_BIT1: begin      // Shift out the upper bit of the bin
+            bin_reg[1] <= shift_out;
+            state_reg <= ST_BIT0;
+        end
+        ST_BIT0: begin      // Shift out the lower bit of the bin
+            bin_reg[0] <= shift_out;
+            state_reg <= ST_COUNT;
+        end
+        default: begin      // Unidentified state
+            state_reg <= ST_IDLE;
+        end
+    endcase
+end
+assign          state = state_reg;
+assign          bin = clamp_reg ? 2'b11 : bin_reg;
+
+// Internal control signals
+// COUNT loads the next sample while the bin is incremented.
+always @(state or f0_empty or bin or ff01_0 or ff01_1 or ff23_0 or ff23_1) begin
+    cnt01_addr = CS_IDLE;
+    cnt23_addr = CS_IDLE;
+    casez (state)
+        ST_IDLE: begin
+            idx_addr = CS_IDLE;
+            busy_reg = 1'b0;
+        end
+        ST_LOAD: begin
+            idx_addr = CS_LOAD;
+            busy_reg = 1'b1;
+        end
+        ST_SKIP, ST_BIT1, ST_BIT0: begin
+            idx_addr = CS_SHIFT;
+            busy_reg = 1'b1;
+        end
+        ST_COUNT: begin
+            idx_addr = f0_empty ? CS_IDLE : CS_LOAD;
+            busy_reg = 1'b1;
+            case (bin)
+                2'd0: if (~ff01_0[1]) cnt01_addr = CS_INC0;
+                2'd1: if (~ff01_1[1]) cnt01_addr = CS_INC1;
+                2'd2: if (~ff23_0[1]) cnt23_addr = CS_INC0;
+                2'd3: if (~ff23_1[1]) cnt23_addr = CS_INC1;
+            endcase
+        end
+        default: begin
+            idx_addr = CS_IDLE;
+            busy_reg = 1'b0;
+        end
+    endcase
+end
+
+assign dreq = f0_not_full;
+assign busy = busy_reg;
+
+cy_psoc3_dp #(.cy_dpconfig(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC___F0, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: LOAD: A0 <= F0*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP___SL, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: SHIFT: A0 <= A0 << 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7:  */
+    8'hFF, 8'h00,  /*CFG9:  */
+    8'hFF, 8'hFF,  /*CFG11-10:  */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_ARITH, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_DEFSI, /*CFG13-12:  */
+    `SC_A0_SRC_ACC, `SC_SHIFT_SL, 1'h0,
+    1'h0, `SC_FIFO1_BUS, `SC_FIFO0_BUS,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_NOCHN,
+    `SC_FB_NOCHN, `SC_CMP1_NOCHN,
+    `SC_CMP0_NOCHN, /*CFG15-14:  */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16:  */
+}
+)) idx(
+        /*  input                   */  .reset(reset),
+        /*  input                   */  .clk(clock),
+        /*  input   [02:00]         */  .cs_addr(idx_addr[2:0]),
+        /*  input                   */  .route_si(1'b0),
+        /*  input                   */  .route_ci(1'b0),
+        /*  input                   */  .f0_load(1'b0),
+        /*  input                   */  .f1_load(1'b0),
+        /*  input                   */  .d0_load(1'b0),
+        /*  input                   */  .d1_load(1'b0),
+        /*  output                  */  .ce0(),
+        /*  output                  */  .cl0(),
+        /*  output                  */  .z0(),
+        /*  output                  */  .ff0(),
+        /*  output                  */  .ce1(),
+        /*  output                  */  .cl1(),
+        /*  output                  */  .z1(),
+        /*  output                  */  .ff1(),
+        /*  output                  */  .ov_msb(),
+        /*  output                  */  .co_msb(),
+        /*  output                  */  .cmsb(),
+        /*  output                  */  .so(shift_out),
+        /*  output                  */  .f0_bus_stat(f0_not_full),
+        /*  output                  */  .f0_blk_stat(f0_empty),
+        /*  output                  */  .f1_bus_stat(),
+        /*  output                  */  .f1_blk_stat(),
+        
+        /* input                    */  .ci(1'b0),     // Carry in from previous stage
+        /* output                   */  .co(),         // Carry out to next stage
+        /* input                    */  .sir(1'b0),    // Shift in from right side
+        /* output                   */  .sor(),        // Shift out to right side
+        /* input                    */  .sil(1'b0),    // Shift in from left side
+        /* output                   */  .sol(),        // Shift out to left side
+        /* input                    */  .msbi(1'b0),   // MSB chain in
+        /* output                   */  .msbo(),       // MSB chain out
+        /* input [01:00]            */  .cei(2'b0),    // Compare equal in from prev stage
+        /* output [01:00]           */  .ceo(),        // Compare equal out to next stage
+        /* input [01:00]            */  .cli(2'b0),    // Compare less than in from prv stage
+        /* output [01:00]           */  .clo(),        // Compare less than out to next stage
+        /* input [01:00]            */  .zi(2'b0),     // Zero detect in from previous stage
+        /* output [01:00]           */  .zo(),         // Zero detect out to next stage
+        /* input [01:00]            */  .fi(2'b0),     // 0xFF detect in from previous stage
+        /* output [01:00]           */  .fo(),         // 0xFF detect out to next stage
+        /* input [01:00]            */  .capi(2'b0),   // Software capture from previous stage
+        /* output [01:00]           */  .capo(),       // Software capture to next stage
+        /* input                    */  .cfbi(1'b0),   // CRC Feedback in from previous stage
+        /* output                   */  .cfbo(),       // CRC Feedback out to next stage
+        /* input [07:00]            */  .pi(8'b0),     // Parallel data port
+        /* output [07:00]           */  .po()          // Parallel data port
+);
+cy_psoc3_dp16 #(.cy_dpconfig_a(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP__INC, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: INC0: A0 <= A0 + 1*/
+    `CS_ALU_OP__INC, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: INC1: A1 <= A1 + 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7: */
+    8'hFF, 8'h00,  /*CFG9: */
+    8'hFF, 8'hFF,  /*CFG11-10: */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_ARITH, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_DEFSI, /*CFG13-12: */
+    `SC_A0_SRC_ACC, `SC_SHIFT_SL, 1'h0,
+    1'h0, `SC_FIFO1_BUS, `SC_FIFO0_BUS,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_NOCHN,
+    `SC_FB_NOCHN, `SC_CMP1_NOCHN,
+    `SC_CMP0_NOCHN, /*CFG15-14: */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16: */
+}
+), .cy_dpconfig_b(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP__INC, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: INC0: A0 <= A0 + 1*/
+    `CS_ALU_OP__INC, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: INC1: A1 <= A1 + 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7: */
+    8'hFF, 8'h00,  /*CFG9: */
+    8'hFF, 8'hFF,  /*CFG11-10: */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_CHAIN, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_DEFSI, /*CFG13-12: */
+    `SC_A0_SRC_ACC, `SC_SHIFT_SL, 1'h0,
+    1'h0, `SC_FIFO1_BUS, `SC_FIFO0_BUS,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_CHNED,
+    `SC_FB_NOCHN, `SC_CMP1_CHNED,
+    `SC_CMP0_CHNED, /*CFG15-14: */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16: */
+}
+)) cnt01(
+        /*  input                   */  .reset(reset),
+        /*  input                   */  .clk(clock),
+        /*  input   [02:00]         */  .cs_addr(cnt01_addr[2:0]),
+        /*  input                   */  .route_si(1'b0),
+        /*  input                   */  .route_ci(1'b0),
+        /*  input                   */  .f0_load(1'b0),
+        /*  input                   */  .f1_load(1'b0),
+        /*  input                   */  .d0_load(1'b0),
+        /*  input                   */  .d1_load(1'b0),
+        /*  output  [01:00]                  */  .ce0(),
+        /*  output  [01:00]                  */  .cl0(),
+        /*  output  [01:00]                  */  .z0(),
+        /*  output  [01:00]                  */  .ff0(ff01_0),
+        /*  output  [01:00]                  */  .ce1(),
+        /*  output  [01:00]                  */  .cl1(),
+        /*  output  [01:00]                  */  .z1(),
+        /*  output  [01:00]                  */  .ff1(ff01_1),
+        /*  output  [01:00]                  */  .ov_msb(),
+        /*  output  [01:00]                  */  .co_msb(),
+        /*  output  [01:00]                  */  .cmsb(),
+        /*  output  [01:00]                  */  .so(),
+        /*  output  [01:00]                  */  .f0_bus_stat(),
+        /*  output  [01:00]                  */  .f0_blk_stat(),
+        /*  output  [01:00]                  */  .f1_bus_stat(),
+        /*  output  [01:00]                  */  .f1_blk_stat()
+);
+cy_psoc3_dp16 #(.cy_dpconfig_a(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP__INC, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: INC0: A0 <= A0 + 1*/
+    `CS_ALU_OP__INC, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: INC1: A1 <= A1 + 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7: */
+    8'hFF, 8'h00,  /*CFG9: */
+    8'hFF, 8'hFF,  /*CFG11-10: */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_ARITH, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_DEFSI, /*CFG13-12: */
+    `SC_A0_SRC_ACC, `SC_SHIFT_SL, 1'h0,
+    1'h0, `SC_FIFO1_BUS, `SC_FIFO0_BUS,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_NOCHN,
+    `SC_FB_NOCHN, `SC_CMP1_NOCHN,
+    `SC_CMP0_NOCHN, /*CFG15-14: */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16: */
+}
+), .cy_dpconfig_b(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP__INC, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: INC0: A0 <= A0 + 1*/
+    `CS_ALU_OP__INC, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: INC1: A1 <= A1 + 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6: */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7: */
+    8'hFF, 8'h00,  /*CFG9: */
+    8'hFF, 8'hFF,  /*CFG11-10: */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_CHAIN, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_DEFSI, /*CFG13-12: */
+    `SC_A0_SRC_ACC, `SC_SHIFT_SL, 1'h0,
+    1'h0, `SC_FIFO1_BUS, `SC_FIFO0_BUS,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_CHNED,
+    `SC_FB_NOCHN, `SC_CMP1_CHNED,
+    `SC_CMP0_CHNED, /*CFG15-14: */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16: */
+}
+)) cnt23(
+        /*  input                   */  .reset(reset),
+        /*  input                   */  .clk(clock),
+        /*  input   [02:00]         */  .cs_addr(cnt23_addr[2:0]),
+        /*  input                   */  .route_si(1'b0),
+        /*  input                   */  .route_ci(1'b0),
+        /*  input                   */  .f0_load(1'b0),
+        /*  input                   */  .f1_load(1'b0),
+        /*  input                   */  .d0_load(1'b0),
+        /*  input                   */  .d1_load(1'b0),
+        /*  output  [01:00]                  */  .ce0(),
+        /*  output  [01:00]                  */  .cl0(),
+        /*  output  [01:00]                  */  .z0(),
+        /*  output  [01:00]                  */  .ff0(ff23_0),
+        /*  output  [01:00]                  */  .ce1(),
+        /*  output  [01:00]                  */  .cl1(),
+        /*  output  [01:00]                  */  .z1(),
+        /*  output  [01:00]                  */  .ff1(ff23_1),
+        /*  output  [01:00]                  */  .ov_msb(),
+        /*  output  [01:00]                  */  .co_msb(),
+        /*  output  [01:00]                  */  .cmsb(),
+        /*  output  [01:00]                  */  .so(),
+        /*  output  [01:00]                  */  .f0_bus_stat(),
+        /*  output  [01:00]                  */  .f0_blk_stat(),
+        /*  output  [01:00]                  */  .f1_bus_stat(),
+        /*  output  [01:00]                  */  .f1_blk_stat()
+);
+//`#end` -- edit above this line, do not edit this line
+endmodule
+//`#start footer` -- edit after this line, do not edit this line
+//`#end` -- edit above this line, do not edit this line
+
+
@@ -0,0 +1,40 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+// Post a word from an ISR or the main loop.
+// Returns 0 when the mailbox is FULL and the word is dropped.
+// A single producer needs no critical section.
+uint8 `$INSTANCE_NAME`_Post(`$INSTANCE_NAME`_value value) {
+    if (`$INSTANCE_NAME`_STATUS_REG & `$INSTANCE_NAME`_STS_FULL) {
+        return 0u;
+    }
+    `$INSTANCE_NAME`_INPUT_REG = value;
+    return 1u;
+}
+
+// Fetch a word in the consumer.
+// Returns 0 when no word is available.
+uint8 `$INSTANCE_NAME`_Fetch(`$INSTANCE_NAME`_value *value) {
+    if (!(`$INSTANCE_NAME`_STATUS_REG & `$INSTANCE_NAME`_STS_AVAIL)) {
+        return 0u;
+    }
+    *value = `$INSTANCE_NAME`_OUTPUT_REG;
+    return 1u;
+}
+
+uint8 `$INSTANCE_NAME`_ReadStatus(void) {
+    return `$INSTANCE_NAME`_STATUS_REG;
+}
+
+/* [] END OF FILE */
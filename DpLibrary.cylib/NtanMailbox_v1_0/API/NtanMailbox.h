@@ -0,0 +1,51 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANMAILBOX_`$INSTANCE_NAME`_H)
+#define NTANMAILBOX_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+#define `$INSTANCE_NAME`_WIDTH (`$Width`u)
+
+#if (`$INSTANCE_NAME`_WIDTH == 32u)
+typedef uint32 `$INSTANCE_NAME`_value;
+#define `$INSTANCE_NAME`_INPUT_PTR  ((reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__F0_REG)
+#define `$INSTANCE_NAME`_OUTPUT_PTR ((reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__F1_REG)
+#elif (`$INSTANCE_NAME`_WIDTH == 16u)
+typedef uint16 `$INSTANCE_NAME`_value;
+#define `$INSTANCE_NAME`_INPUT_PTR  ((reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_F0_REG)
+#define `$INSTANCE_NAME`_OUTPUT_PTR ((reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_F1_REG)
+#else
+typedef uint8 `$INSTANCE_NAME`_value;
+#define `$INSTANCE_NAME`_INPUT_PTR  ((reg8 *)`$INSTANCE_NAME`_sW8_dp__F0_REG)
+#define `$INSTANCE_NAME`_OUTPUT_PTR ((reg8 *)`$INSTANCE_NAME`_sW8_dp__F1_REG)
+#endif
+#define `$INSTANCE_NAME`_INPUT_REG  (* `$INSTANCE_NAME`_INPUT_PTR)
+#define `$INSTANCE_NAME`_OUTPUT_REG (* `$INSTANCE_NAME`_OUTPUT_PTR)
+
+// Status register
+// Sampled at the component clock, which must be BUS_CLK so that
+// Post() and Fetch() never see a stale FULL or AVAIL.
+#define `$INSTANCE_NAME`_STATUS_REG (* (reg8 *)`$INSTANCE_NAME`_stsreg__STATUS_REG)
+#define `$INSTANCE_NAME`_STATUS_PTR (  (reg8 *)`$INSTANCE_NAME`_stsreg__STATUS_REG)
+#define `$INSTANCE_NAME`_STS_AVAIL  (0x01u)
+#define `$INSTANCE_NAME`_STS_DREQ   (0x02u)
+#define `$INSTANCE_NAME`_STS_FULL   (0x04u)
+
+extern uint8 `$INSTANCE_NAME`_Post(`$INSTANCE_NAME`_value value);
+extern uint8 `$INSTANCE_NAME`_Fetch(`$INSTANCE_NAME`_value *value);
+extern uint8 `$INSTANCE_NAME`_ReadStatus(void);
+
+#endif // NTANMAILBOX_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
@@ -0,0 +1,28 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+#if (`$INSTANCE_NAME`_PATTERN == `$INSTANCE_NAME`_PATTERN_COUNT)
+// The next character sent is value + 1.
+void `$INSTANCE_NAME`_WriteCount(uint8 value) {
+    `$INSTANCE_NAME`_COUNT_REG = value;
+}
+#endif
+
+#if (`$INSTANCE_NAME`_PATTERN == `$INSTANCE_NAME`_PATTERN_FIXED)
+void `$INSTANCE_NAME`_WriteFixed(uint8 value) {
+    `$INSTANCE_NAME`_FIXED_REG = value;
+}
+#endif
+
+/* [] END OF FILE */
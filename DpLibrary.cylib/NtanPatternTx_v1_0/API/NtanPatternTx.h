@@ -0,0 +1,44 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANPATTERNTX_`$INSTANCE_NAME`_H)
+#define NTANPATTERNTX_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+#define `$INSTANCE_NAME`_PATTERN        (`$Pattern`u)
+
+#define `$INSTANCE_NAME`_PATTERN_PRBS7  (0u)
+#define `$INSTANCE_NAME`_PATTERN_PRBS15 (1u)
+#define `$INSTANCE_NAME`_PATTERN_PRBS23 (2u)
+#define `$INSTANCE_NAME`_PATTERN_COUNT  (3u)
+#define `$INSTANCE_NAME`_PATTERN_FIXED  (4u)
+
+#if (`$INSTANCE_NAME`_PATTERN == `$INSTANCE_NAME`_PATTERN_COUNT)
+// Last character sent in the counting pattern
+#define `$INSTANCE_NAME`_COUNT_REG (* (reg8 *)`$INSTANCE_NAME`_sP8_dp__A1_REG)
+#define `$INSTANCE_NAME`_COUNT_PTR (  (reg8 *)`$INSTANCE_NAME`_sP8_dp__A1_REG)
+
+extern void `$INSTANCE_NAME`_WriteCount(uint8 value);
+#endif
+
+#if (`$INSTANCE_NAME`_PATTERN == `$INSTANCE_NAME`_PATTERN_FIXED)
+// Character sent in the fixed pattern
+#define `$INSTANCE_NAME`_FIXED_REG (* (reg8 *)`$INSTANCE_NAME`_sP8_dp__D0_REG)
+#define `$INSTANCE_NAME`_FIXED_PTR (  (reg8 *)`$INSTANCE_NAME`_sP8_dp__D0_REG)
+
+extern void `$INSTANCE_NAME`_WriteFixed(uint8 value);
+#endif
+
+#endif // NTANPATTERNTX_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
@@ -0,0 +1,36 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANPERFCOUNTER_`$INSTANCE_NAME`_H)
+#define NTANPERFCOUNTER_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+#define `$INSTANCE_NAME`_WIDTH (`$Width`u)
+
+#if (`$INSTANCE_NAME`_WIDTH == 16u)
+#define `$INSTANCE_NAME`_COUNT_REG (* (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_COUNT_PTR (  (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_A0_REG)
+#else
+#define `$INSTANCE_NAME`_COUNT_REG (* (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__A0_REG)
+#define `$INSTANCE_NAME`_COUNT_PTR (  (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__A0_REG)
+// Halves for a carry-safe read
+#define `$INSTANCE_NAME`_COUNT_LO_REG (* (reg16 *)`$INSTANCE_NAME`_sW32_dp_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_COUNT_HI_REG (* (reg16 *)`$INSTANCE_NAME`_sW32_dp_u2__16BIT_A0_REG)
+#endif
+
+extern uint32 `$INSTANCE_NAME`_ReadCount(void);
+extern void `$INSTANCE_NAME`_ClearCount(void);
+
+#endif // NTANPERFCOUNTER_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
@@ -0,0 +1,20 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+// Write before releasing RESET to arm the trigger.
+void `$INSTANCE_NAME`_WriteTrigger(uint8 value) {
+    `$INSTANCE_NAME`_TRIGGER_REG = value;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,33 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANPROBECAPTURE_`$INSTANCE_NAME`_H)
+#define NTANPROBECAPTURE_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+// A record is a pair of VALUE and COUNT
+// The record in progress is pushed as STOP goes HIGH, so the
+// rings hold the whole capture once both DMAs are done.
+#define `$INSTANCE_NAME`_VALUE_REG (* (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
+#define `$INSTANCE_NAME`_VALUE_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
+#define `$INSTANCE_NAME`_COUNT_REG (* (reg8 *)`$INSTANCE_NAME`_dp__F1_REG)
+#define `$INSTANCE_NAME`_COUNT_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__F1_REG)
+// Sample value to start recording
+#define `$INSTANCE_NAME`_TRIGGER_REG (* (reg8 *)`$INSTANCE_NAME`_dp__D0_REG)
+#define `$INSTANCE_NAME`_TRIGGER_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__D0_REG)
+
+extern void `$INSTANCE_NAME`_WriteTrigger(uint8 value);
+
+#endif // NTANPROBECAPTURE_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
@@ -0,0 +1,259 @@
+
+//`#start header` -- edit after this line, do not edit this line
+// ========================================
+//
+// Copyright YOUR COMPANY, THE YEAR
+// All Rights Reserved
+// UNPUBLISHED, LICENSED SOFTWARE.
+//
+// CONFIDENTIAL AND PROPRIETARY INFORMATION
+// WHICH IS THE PROPERTY OF your company.
+//
+// ========================================
+`include "cypress.v"
+//`#end` -- edit above this line, do not edit this line
+// Generated on 10/19/2026 at 16:05
+// Component: NtanProbeCapture_v1_0
+module NtanProbeCapture_v1_0 (
+	output  dreq_count,
+	output  dreq_value,
+	output  ovr,
+	output  triggered,
+	input   clock,
+	input  [7:0] probe,
+	input   reset,
+	input   stop
+);
+	parameter UseTrigger = 0;
+
+//`#start body` -- edit after this line, do not edit this line
+
+// The probe bus is sampled at every clock and unchanged samples
+// are run-length encoded.  A record is a pair of
+//   F0 : sample value (A0)
+//   F1 : number of clocks the value lasted (A1, 1 to 255)
+// pushed when the value changes or the count reaches 255.
+// Two DMA channels move F0 and F1 into parallel SRAM rings.
+// With UseTrigger, recording starts when the sample equals D0.
+// STOP ends the recording: the record in progress is pushed with
+// the count so far, and no sample is taken until RESET.  The
+// sample at the clock STOP is seen is not recorded.
+// RESET re-arms the trigger.
+
+// State code declaration
+localparam      ST_IDLE     = 2'b00;
+localparam      ST_ARM      = 2'b01;
+localparam      ST_RUN      = 2'b11;
+localparam      ST_STOP     = 2'b10;
+
+// Datapath function
+localparam      CS_IDLE     = 3'b000;
+localparam      CS_START    = 3'b001;
+localparam      CS_COUNT    = 3'b010;
+
+// Wire declaration
+wire[1:0]       state;          // State code
+wire            f0_not_empty;   // F0 is NOT EMPTY
+wire            f0_full;        // F0 is FULL
+wire            f1_not_empty;   // F1 is NOT EMPTY
+wire            trig;           // Trigger condition A0 == D0
+wire            count_full;     // A1 == 0xFF
+wire            changed;        // Sample differs from A0
+wire            run;            // Encode the sample
+wire            push;           // Push a record
+wire            flush;          // Push the last record on STOP
+
+// Pseudo register
+reg[2:0]        addr;           // Datapath function
+
+// Input synchronizer
+reg[7:0]        probe_reg;      // Sampled probe bus
+reg             stop_reg;       // Sampled STOP
+reg[7:0]        last_reg;       // Copy of A0
+
+// Status pulse
+reg             ovr_reg;        // Overrun
+
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        probe_reg <= 8'h00;
+        stop_reg <= 1'b0;
+    end else begin
+        probe_reg <= probe;
+        stop_reg <= stop;
+    end
+end
+
+assign      changed = (probe_reg != last_reg);
+assign      run = (state == ST_RUN) | ((state == ST_ARM) & ~stop_reg & (trig | ~UseTrigger));
+assign      flush = (state == ST_RUN) & stop_reg;
+assign      push = run & (changed | count_full | flush);
+
+// State machine behavior
+reg [1:0]       state_reg;
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        state_reg <= ST_IDLE;
+    end else casez (state)
+        ST_IDLE: begin      // Load the first sample
+            state_reg <= ST_ARM;
+        end
+        ST_ARM: begin       // Wait for the trigger
+            if (stop_reg) begin
+                state_reg <= ST_STOP;
+            end else if (run) begin
+                state_reg <= ST_RUN;
+            end
+        end
+        ST_RUN: begin       // Record until STOP or RESET
+            if (stop_reg) begin
+                state_reg <= ST_STOP;
+            end
+        end
+        ST_STOP: begin      // The last record has been pushed
+            state_reg <= ST_STOP;
+        end
+        default: begin      // Unidentified state
+            state_reg <= ST_IDLE;
+        end
+    endcase
+end
+assign      state = state_reg;
+assign      triggered = (state == ST_RUN);
+
+// Internal control signals
+always @(run or push) begin
+    if (run & ~push) begin
+        addr = CS_COUNT;
+    end else begin
+        addr = CS_START;
+    end
+end
+
+// Copy of A0 behavior
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        last_reg <= 8'h00;
+    end else if (addr == CS_START) begin
+        last_reg <= probe_reg;
+    end
+end
+
+// Status flag behavior
+// A record is lost when the FIFO is FULL.
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        ovr_reg <= 1'b0;
+    end else begin
+        ovr_reg <= push & f0_full;
+    end
+end
+assign ovr = ovr_reg;
+
+// DREQ output behavior
+assign dreq_value = f0_not_empty;
+assign dreq_count = f1_not_empty;
+
+cy_psoc3_dp #(.cy_d1_init(8'h01), .cy_dpconfig(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC__ALU, `CS_A1_SRC___D1,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: START: A0 <= probe, A1 <= D1 (1)*/
+    `CS_ALU_OP__INC, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: COUNT: A1 <= A1 + 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7:  */
+    8'hFF, 8'h00,  /*CFG9:  */
+    8'hFF, 8'hFF,  /*CFG11-10:  */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_ARITH, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_DEFSI, /*CFG13-12:  */
+    `SC_A0_SRC_PIN, `SC_SHIFT_SL, 1'h0,
+    1'h0, `SC_FIFO1__A1, `SC_FIFO0__A0,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_NOCHN,
+    `SC_FB_NOCHN, `SC_CMP1_NOCHN,
+    `SC_CMP0_NOCHN, /*CFG15-14:  */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16:  */
+}
+)) dp(
+        /*  input                   */  .reset(reset),
+        /*  input                   */  .clk(clock),
+        /*  input   [02:00]         */  .cs_addr(addr[2:0]),
+        /*  input                   */  .route_si(1'b0),
+        /*  input                   */  .route_ci(1'b0),
+        /*  input                   */  .f0_load(push),
+        /*  input                   */  .f1_load(push),
+        /*  input                   */  .d0_load(1'b0),
+        /*  input                   */  .d1_load(1'b0),
+        /*  output                  */  .ce0(trig),
+        /*  output                  */  .cl0(),
+        /*  output                  */  .z0(),
+        /*  output                  */  .ff0(),
+        /*  output                  */  .ce1(),
+        /*  output                  */  .cl1(),
+        /*  output                  */  .z1(),
+        /*  output                  */  .ff1(count_full),
+        /*  output                  */  .ov_msb(),
+        /*  output                  */  .co_msb(),
+        /*  output                  */  .cmsb(),
+        /*  output                  */  .so(),
+        /*  output                  */  .f0_bus_stat(f0_not_empty),
+        /*  output                  */  .f0_blk_stat(f0_full),
+        /*  output                  */  .f1_bus_stat(f1_not_empty),
+        /*  output                  */  .f1_blk_stat(),
+        
+        /* input                    */  .ci(1'b0),     // Carry in from previous stage
+        /* output                   */  .co(),         // Carry out to next stage
+        /* input                    */  .sir(1'b0),    // Shift in from right side
+        /* output                   */  .sor(),        // Shift out to right side
+        /* input                    */  .sil(1'b0),    // Shift in from left side
+        /* output                   */  .sol(),        // Shift out to left side
+        /* input                    */  .msbi(1'b0),   // MSB chain in
+        /* output                   */  .msbo(),       // MSB chain out
+        /* input [01:00]            */  .cei(2'b0),    // Compare equal in from prev stage
+        /* output [01:00]           */  .ceo(),        // Compare equal out to next stage
+        /* input [01:00]            */  .cli(2'b0),    // Compare less than in from prv stage
+        /* output [01:00]           */  .clo(),        // Compare less than out to next stage
+        /* input [01:00]            */  .zi(2'b0),     // Zero detect in from previous stage
+        /* output [01:00]           */  .zo(),         // Zero detect out to next stage
+        /* input [01:00]            */  .fi(2'b0),     // 0xFF detect in from previous stage
+        /* output [01:00]           */  .fo(),         // 0xFF detect out to next stage
+        /* input [01:00]            */  .capi(2'b0),   // Software capture from previous stage
+        /* output [01:00]           */  .capo(),       // Software capture to next stage
+        /* input                    */  .cfbi(1'b0),   // CRC Feedback in from previous stage
+        /* output                   */  .cfbo(),       // CRC Feedback out to next stage
+        /* input [07:00]            */  .pi(probe_reg), // Parallel data port
+        /* output [07:00]           */  .po()          // Parallel data port
+);
+//`#end` -- edit above this line, do not edit this line
+endmodule
+//`#start footer` -- edit after this line, do not edit this line
+//`#end` -- edit above this line, do not edit this line
@@ -11,18 +11,32 @@
 */
 #include "`$INSTANCE_NAME`.h"
 
-uint8 `$INSTANCE_NAME`_ReadA0(void) {
-    return CY_GET_REG8(`$INSTANCE_NAME`_A0_PTR);
+`$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadA0(void) {
+    return `$INSTANCE_NAME`_A0_REG;
 }
-void `$INSTANCE_NAME`_WriteA0(uint8 value) {
-    CY_SET_REG8(`$INSTANCE_NAME`_A0_PTR, value);
+void `$INSTANCE_NAME`_WriteA0(`$INSTANCE_NAME`_value value) {
+    `$INSTANCE_NAME`_A0_REG = value;
 }
 
-uint8 `$INSTANCE_NAME`_ReadA1(void) {
-    return CY_GET_REG8(`$INSTANCE_NAME`_A1_PTR);
+`$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadA1(void) {
+    return `$INSTANCE_NAME`_A1_REG;
 }
-void `$INSTANCE_NAME`_WriteA1(uint8 value) {
-    CY_SET_REG8(`$INSTANCE_NAME`_A1_PTR, value);
+void `$INSTANCE_NAME`_WriteA1(`$INSTANCE_NAME`_value value) {
+    `$INSTANCE_NAME`_A1_REG = value;
+}
+
+`$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadD0(void) {
+    return `$INSTANCE_NAME`_D0_REG;
+}
+void `$INSTANCE_NAME`_WriteD0(`$INSTANCE_NAME`_value value) {
+    `$INSTANCE_NAME`_D0_REG = value;
+}
+
+`$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadD1(void) {
+    return `$INSTANCE_NAME`_D1_REG;
+}
+void `$INSTANCE_NAME`_WriteD1(`$INSTANCE_NAME`_value value) {
+    `$INSTANCE_NAME`_D1_REG = value;
 }
 
 /* [] END OF FILE */
@@ -15,15 +15,42 @@
     
 #include <cytypes.h>
 
-#define `$INSTANCE_NAME`_A0_PTR ((reg8 *)`$INSTANCE_NAME`_dp__A0_REG)
-#define `$INSTANCE_NAME`_A1_PTR ((reg8 *)`$INSTANCE_NAME`_dp__A1_REG)
-#define `$INSTANCE_NAME`_D0_PTR ((reg8 *)`$INSTANCE_NAME`_dp__D0_REG)
-#define `$INSTANCE_NAME`_D1_PTR ((reg8 *)`$INSTANCE_NAME`_dp__D1_REG)
+#define `$INSTANCE_NAME`_WIDTH (`$Width`u)
 
-extern uint8 `$INSTANCE_NAME`_ReadA0(void);
-extern void `$INSTANCE_NAME`_WriteA0(uint8 value);
-extern uint8 `$INSTANCE_NAME`_ReadA1(void);
-extern void `$INSTANCE_NAME`_WriteA1(uint8 value);
+#if (`$INSTANCE_NAME`_WIDTH == 32u)
+typedef uint32 `$INSTANCE_NAME`_value;
+#define `$INSTANCE_NAME`_A0_PTR ((reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__A0_REG)
+#define `$INSTANCE_NAME`_A1_PTR ((reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__A1_REG)
+#define `$INSTANCE_NAME`_D0_PTR ((reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__D0_REG)
+#define `$INSTANCE_NAME`_D1_PTR ((reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__D1_REG)
+#elif (`$INSTANCE_NAME`_WIDTH == 16u)
+typedef uint16 `$INSTANCE_NAME`_value;
+#define `$INSTANCE_NAME`_A0_PTR ((reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_A1_PTR ((reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_A1_REG)
+#define `$INSTANCE_NAME`_D0_PTR ((reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_D0_REG)
+#define `$INSTANCE_NAME`_D1_PTR ((reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_D1_REG)
+#else
+typedef uint8 `$INSTANCE_NAME`_value;
+#define `$INSTANCE_NAME`_A0_PTR ((reg8 *)`$INSTANCE_NAME`_sW8_dp__A0_REG)
+#define `$INSTANCE_NAME`_A1_PTR ((reg8 *)`$INSTANCE_NAME`_sW8_dp__A1_REG)
+#define `$INSTANCE_NAME`_D0_PTR ((reg8 *)`$INSTANCE_NAME`_sW8_dp__D0_REG)
+#define `$INSTANCE_NAME`_D1_PTR ((reg8 *)`$INSTANCE_NAME`_sW8_dp__D1_REG)
+#endif
+
+// Fast path: a single bus access without a function call
+#define `$INSTANCE_NAME`_A0_REG (* `$INSTANCE_NAME`_A0_PTR)
+#define `$INSTANCE_NAME`_A1_REG (* `$INSTANCE_NAME`_A1_PTR)
+#define `$INSTANCE_NAME`_D0_REG (* `$INSTANCE_NAME`_D0_PTR)
+#define `$INSTANCE_NAME`_D1_REG (* `$INSTANCE_NAME`_D1_PTR)
+
+extern `$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadA0(void);
+extern void `$INSTANCE_NAME`_WriteA0(`$INSTANCE_NAME`_value value);
+extern `$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadA1(void);
+extern void `$INSTANCE_NAME`_WriteA1(`$INSTANCE_NAME`_value value);
+extern `$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadD0(void);
+extern void `$INSTANCE_NAME`_WriteD0(`$INSTANCE_NAME`_value value);
+extern `$INSTANCE_NAME`_value `$INSTANCE_NAME`_ReadD1(void);
+extern void `$INSTANCE_NAME`_WriteD1(`$INSTANCE_NAME`_value value);
 
 #endif // `$INSTANCE_NAME`_H
 
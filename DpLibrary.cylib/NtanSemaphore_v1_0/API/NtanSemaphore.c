@@ -0,0 +1,26 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+// Set the flags in mask; other flags are not affected.
+void `$INSTANCE_NAME`_Set(uint8 mask) {
+    `$INSTANCE_NAME`_SET_REG = mask;
+}
+
+// Take all flags set since the last call.
+// No interrupt lock is needed because the read clears them.
+uint8 `$INSTANCE_NAME`_Take(void) {
+    return `$INSTANCE_NAME`_TAKE_REG;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,30 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANSEMAPHORE_`$INSTANCE_NAME`_H)
+#define NTANSEMAPHORE_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+// Writing 1 sets the flag
+#define `$INSTANCE_NAME`_SET_REG  (* (reg8 *)`$INSTANCE_NAME`_ctrlreg__CONTROL_REG)
+#define `$INSTANCE_NAME`_SET_PTR  (  (reg8 *)`$INSTANCE_NAME`_ctrlreg__CONTROL_REG)
+// Reading returns and clears the flags
+#define `$INSTANCE_NAME`_TAKE_REG (* (reg8 *)`$INSTANCE_NAME`_stsreg__STATUS_REG)
+#define `$INSTANCE_NAME`_TAKE_PTR (  (reg8 *)`$INSTANCE_NAME`_stsreg__STATUS_REG)
+
+extern void `$INSTANCE_NAME`_Set(uint8 mask);
+extern uint8 `$INSTANCE_NAME`_Take(void);
+
+#endif // NTANSEMAPHORE_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
@@ -0,0 +1,65 @@
+
+//`#start header` -- edit after this line, do not edit this line
+// ========================================
+//
+// Copyright YOUR COMPANY, THE YEAR
+// All Rights Reserved
+// UNPUBLISHED, LICENSED SOFTWARE.
+//
+// CONFIDENTIAL AND PROPRIETARY INFORMATION
+// WHICH IS THE PROPERTY OF your company.
+//
+// ========================================
+`include "cypress.v"
+//`#end` -- edit above this line, do not edit this line
+// Generated on 10/19/2026 at 11:42
+// Component: NtanSemaphore_v1_0
+module NtanSemaphore_v1_0 (
+	input   clock,
+	input   reset,
+	input  [7:0] set
+);
+	parameter FallingEdge = 0;
+
+//`#start body` -- edit after this line, do not edit this line
+
+// Eight flags shared between hardware, ISRs and the main loop.
+// A flag is set by an edge on the SET input or by writing 1
+// into the control register.  Reading the status register
+// returns the flags and clears them in the same access.
+// Bits in FallingEdge select a falling edge on SET,
+// e.g. to catch the end of BUSY.
+
+// Wire declaration
+wire[7:0]       edge_det;       // Edge detected on SET
+wire[7:0]       ctrl;           // Set pulse from the CPU
+
+// Input edge detector
+reg[7:0]        set_reg;        // Previous SET input
+
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        set_reg <= FallingEdge;
+    end else begin
+        set_reg <= set;
+    end
+end
+assign edge_det = (set & ~set_reg & ~FallingEdge) | (~set & set_reg & FallingEdge);
+
+// Set-on-write control register in pulse mode
+cy_psoc3_control #(.cy_init_value(8'h00), .cy_force_order(1),
+    .cy_ctrl_mode_1(8'hFF), .cy_ctrl_mode_0(8'hFF)) ctrlreg(
+    /* input          */ .clock(clock),
+    /* output [07:00] */ .control(ctrl)
+);
+
+// Clear-on-read status register in sticky mode
+cy_psoc3_status #(.cy_force_order(1), .cy_md_select(8'hFF)) stsreg(
+    /* input          */ .clock(clock),
+    /* input  [07:00] */ .status(edge_det | ctrl)
+);
+
+//`#end` -- edit above this line, do not edit this line
+endmodule
+//`#start footer` -- edit after this line, do not edit this line
+//`#end` -- edit above this line, do not edit this line
@@ -0,0 +1,19 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+void `$INSTANCE_NAME`_WriteValue(uint8 value) {
+    `$INSTANCE_NAME`_INPUT_REG = value;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,28 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANSYNCTX_`$INSTANCE_NAME`_H)
+#define NTANSYNCTX_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+// One bit is sent in every clock, so the bit rate is the
+// frequency of the clock.  SDO changes at the rising edge and
+// SCLK is HIGH in the second half of the clock.
+#define `$INSTANCE_NAME`_INPUT_REG (* (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
+#define `$INSTANCE_NAME`_INPUT_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
+
+extern void `$INSTANCE_NAME`_WriteValue(uint8 value);
+
+#endif // NTANSYNCTX_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
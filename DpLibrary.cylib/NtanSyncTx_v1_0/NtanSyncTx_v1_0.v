@@ -0,0 +1,262 @@
+
+//`#start header` -- edit after this line, do not edit this line
+// ========================================
+//
+// Copyright YOUR COMPANY, THE YEAR
+// All Rights Reserved
+// UNPUBLISHED, LICENSED SOFTWARE.
+//
+// CONFIDENTIAL AND PROPRIETARY INFORMATION
+// WHICH IS THE PROPERTY OF your company.
+//
+// ========================================
+`include "cypress.v"
+//`#end` -- edit above this line, do not edit this line
+// Generated on 10/19/2026 at 11:42
+// Component: NtanSyncTx_v1_0
+module NtanSyncTx_v1_0 (
+	output  dreq,
+	output  sclk,
+	output  sdo,
+	output  ss,
+	input   clock,
+	input   reset
+);
+	parameter MsbFirst = 0;
+
+//`#start body` -- edit after this line, do not edit this line
+
+// Synchronous serial transmitter sharing the NtanUartTx shifter.
+// One bit is sent in every clock with no START/STOP framing.
+// SDO changes at the rising edge of the clock and SCLK is HIGH
+// in the second half of the clock, rising in the middle of the
+// bit.  SCLK is the XOR of a DFF toggled at the falling edge and
+// a DFF following it at the rising edge, so it does not glitch
+// like the clock gated by logic, and the clock itself is not
+// routed to a pin.
+// SS stays LOW while consecutive bytes are sent and its rising
+// edge can be used as a latch strobe.
+
+// State code declaration
+localparam      ST_IDLE     = 2'b00;
+localparam      ST_LOAD     = 2'b01;
+localparam      ST_SHIFT    = 2'b11;
+
+// Datapath function
+localparam      CS_IDLE     = 3'b000;
+localparam      CS_LOAD     = 3'b001;
+localparam      CS_SHIFT    = 3'b010;
+localparam      CS_SH_LOAD  = 3'b011;
+
+// Shift direction
+localparam [1:0] SHFT_OP    = (MsbFirst) ? `CS_SHFT_OP___SL : `CS_SHFT_OP___SR;
+localparam [0:0] SHIFT_SEL  = (MsbFirst) ? `SC_SHIFT_SL : `SC_SHIFT_SR;
+
+// Wire declaration
+wire[1:0]       state;          // State code
+wire            f0_empty;       // F0 is EMPTY
+wire            f0_not_full;    // F0 is not FULL
+wire            so;             // Shift out
+wire            last_bit;       // Last bit of a byte
+
+// Pseudo register
+reg[2:0]        addr;           // Datapath function
+
+// Bit counter
+reg[2:0]        nbit;           // Bit position in a byte
+
+// Output signal buffer
+reg             sdo_reg;        // DFF for SDO
+reg             sclk_en;        // SCLK pulse in this clock
+reg             sclk_n;         // Toggled at the falling edge
+reg             sclk_p;         // sclk_n at the rising edge
+reg             ss_reg;         // DFF for SS
+
+assign      last_bit = (nbit == 3'd7);
+
+// State machine behavior
+reg [1:0]       state_reg;
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+                state_reg <= ST_IDLE;
+                nbit <= 3'd0;
+    end else casez (state)
+        ST_IDLE: begin
+            if (~f0_empty) begin
+                state_reg <= ST_LOAD;
+            end
+        end
+        ST_LOAD: begin
+                state_reg <= ST_SHIFT;
+                nbit <= 3'd0;
+        end
+        ST_SHIFT: begin
+                nbit <= nbit + 3'd1;
+            if (last_bit & f0_empty) begin
+                state_reg <= ST_IDLE;
+            end
+        end
+        default: begin
+                state_reg <= ST_IDLE;
+        end
+    endcase
+end
+assign      state = state_reg;
+
+// Internal control signals
+// The next byte is loaded while the last bit is shifted out.
+always @(state or last_bit or f0_empty) begin
+    casez (state)
+        ST_LOAD: begin
+            addr    = CS_LOAD;
+        end
+        ST_SHIFT: begin
+            addr    = (last_bit & ~f0_empty) ? CS_SH_LOAD : CS_SHIFT;
+        end
+        default: begin
+            addr    = CS_IDLE;
+        end
+    endcase
+end
+
+// Output behavior
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        sdo_reg <= 1'b0;
+        sclk_en <= 1'b0;
+        ss_reg <= 1'b1;
+    end else begin
+        if (state == ST_SHIFT) begin
+            sdo_reg <= so;
+        end
+        sclk_en <= (state == ST_SHIFT);
+        ss_reg <= (state == ST_IDLE);
+    end
+end
+assign sdo = sdo_reg;
+
+// SCLK is HIGH from the falling edge to the next rising edge
+always @(posedge reset or negedge clock) begin
+    if (reset) begin
+        sclk_n <= 1'b0;
+    end else if (sclk_en) begin
+        sclk_n <= ~sclk_n;
+    end
+end
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        sclk_p <= 1'b0;
+    end else begin
+        sclk_p <= sclk_n;
+    end
+end
+assign sclk = sclk_n ^ sclk_p;
+assign ss = ss_reg;
+
+// DREQ output behavior
+assign dreq = f0_not_full;
+
+cy_psoc3_dp #(.cy_dpconfig(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC___F0, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: LOAD - A0 <= F0*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    SHFT_OP, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2: SHIFT: A0 <= A0 >> 1 or A0 << 1*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    SHFT_OP, `CS_A0_SRC___F0, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3: SH_LOAD: shift out and A0 <= F0*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7:  */
+    8'hFF, 8'h00,  /*CFG9:  */
+    8'hFF, 8'hFF,  /*CFG11-10:  */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_ARITH, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_DEFSI, /*CFG13-12:  */
+    `SC_A0_SRC_ACC, SHIFT_SEL, 1'h0,
+    1'h0, `SC_FIFO1_BUS, `SC_FIFO0_BUS,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_NOCHN,
+    `SC_FB_NOCHN, `SC_CMP1_NOCHN,
+    `SC_CMP0_NOCHN, /*CFG15-14:  */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16:  */
+}
+)) dp(
+        /*  input                   */  .reset(reset),
+        /*  input                   */  .clk(clock),
+        /*  input   [02:00]         */  .cs_addr(addr[2:0]),
+        /*  input                   */  .route_si(1'b0),
+        /*  input                   */  .route_ci(1'b0),
+        /*  input                   */  .f0_load(1'b0),
+        /*  input                   */  .f1_load(1'b0),
+        /*  input                   */  .d0_load(1'b0),
+        /*  input                   */  .d1_load(1'b0),
+        /*  output                  */  .ce0(),
+        /*  output                  */  .cl0(),
+        /*  output                  */  .z0(),
+        /*  output                  */  .ff0(),
+        /*  output                  */  .ce1(),
+        /*  output                  */  .cl1(),
+        /*  output                  */  .z1(),
+        /*  output                  */  .ff1(),
+        /*  output                  */  .ov_msb(),
+        /*  output                  */  .co_msb(),
+        /*  output                  */  .cmsb(),
+        /*  output                  */  .so(so),
+        /*  output                  */  .f0_bus_stat(f0_not_full),
+        /*  output                  */  .f0_blk_stat(f0_empty),
+        /*  output                  */  .f1_bus_stat(),
+        /*  output                  */  .f1_blk_stat(),
+
+        /* input                    */  .ci(1'b0),     // Carry in from previous stage
+        /* output                   */  .co(),         // Carry out to next stage
+        /* input                    */  .sir(1'b0),    // Shift in from right side
+        /* output                   */  .sor(),        // Shift out to right side
+        /* input                    */  .sil(1'b0),    // Shift in from left side
+        /* output                   */  .sol(),        // Shift out to left side
+        /* input                    */  .msbi(1'b0),   // MSB chain in
+        /* output                   */  .msbo(),       // MSB chain out
+        /* input [01:00]            */  .cei(2'b0),    // Compare equal in from prev stage
+        /* output [01:00]           */  .ceo(),        // Compare equal out to next stage
+        /* input [01:00]            */  .cli(2'b0),    // Compare less than in from prv stage
+        /* output [01:00]           */  .clo(),        // Compare less than out to next stage
+        /* input [01:00]            */  .zi(2'b0),     // Zero detect in from previous stage
+        /* output [01:00]           */  .zo(),         // Zero detect out to next stage
+        /* input [01:00]            */  .fi(2'b0),     // 0xFF detect in from previous stage
+        /* output [01:00]           */  .fo(),         // 0xFF detect out to next stage
+        /* input [01:00]            */  .capi(2'b0),   // Software capture from previous stage
+        /* output [01:00]           */  .capo(),       // Software capture to next stage
+        /* input                    */  .cfbi(1'b0),   // CRC Feedback in from previous stage
+        /* output                   */  .cfbo(),       // CRC Feedback out to next stage
+        /* input [07:00]            */  .pi(8'b0),     // Parallel data port
+        /* output [07:00]           */  .po()          // Parallel data port
+);
+//`#end` -- edit above this line, do not edit this line
+endmodule
+//`#start footer` -- edit after this line, do not edit this line
+//`#end` -- edit above this line, do not edit this line
+
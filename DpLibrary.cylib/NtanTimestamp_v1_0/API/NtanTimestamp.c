@@ -0,0 +1,37 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+// Oldest timestamp in the FIFO, valid while READY is HIGH
+uint32 `$INSTANCE_NAME`_ReadTimestamp(void) {
+    return `$INSTANCE_NAME`_TIMESTAMP_REG;
+}
+
+// The counter may carry between the two halves of a 32-bit read,
+// so the upper half is read again to detect it.
+uint32 `$INSTANCE_NAME`_ReadCount(void) {
+#if (`$INSTANCE_NAME`_WIDTH == 16u)
+    return `$INSTANCE_NAME`_COUNT_REG;
+#else
+    uint16 hi;
+    uint16 lo;
+    
+    do {
+        hi = `$INSTANCE_NAME`_COUNT_HI_REG;
+        lo = `$INSTANCE_NAME`_COUNT_LO_REG;
+    } while (hi != `$INSTANCE_NAME`_COUNT_HI_REG);
+    return ((uint32)hi << 16) | lo;
+#endif
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,48 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANTIMESTAMP_`$INSTANCE_NAME`_H)
+#define NTANTIMESTAMP_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+#define `$INSTANCE_NAME`_WIDTH (`$Width`u)
+
+// A result record of an Accumulator with ResultFifo=1 is read
+// from its RESULT_PTR and the TIMESTAMP_PTR of this instance,
+// by the CPU or by a DMA chain of two TDs requested by READY.
+//
+// F0 holds four timestamps.  A CAPTURE edge while F0 is full is
+// dropped and OVR is HIGH for one clock, so a sticky status bit or
+// an interrupt on OVR tells that the records are out of step.
+
+#if (`$INSTANCE_NAME`_WIDTH == 16u)
+#define `$INSTANCE_NAME`_TIMESTAMP_REG (* (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_F0_REG)
+#define `$INSTANCE_NAME`_TIMESTAMP_PTR (  (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_F0_REG)
+#define `$INSTANCE_NAME`_COUNT_REG (* (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_COUNT_PTR (  (reg16 *)`$INSTANCE_NAME`_sW16_dp_u0__16BIT_A0_REG)
+#else
+#define `$INSTANCE_NAME`_TIMESTAMP_REG (* (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__F0_REG)
+#define `$INSTANCE_NAME`_TIMESTAMP_PTR (  (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__F0_REG)
+#define `$INSTANCE_NAME`_COUNT_REG (* (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__A0_REG)
+#define `$INSTANCE_NAME`_COUNT_PTR (  (reg32 *)`$INSTANCE_NAME`_sW32_dp_u0__A0_REG)
+// Halves for a carry-safe read
+#define `$INSTANCE_NAME`_COUNT_LO_REG (* (reg16 *)`$INSTANCE_NAME`_sW32_dp_u0__16BIT_A0_REG)
+#define `$INSTANCE_NAME`_COUNT_HI_REG (* (reg16 *)`$INSTANCE_NAME`_sW32_dp_u2__16BIT_A0_REG)
+#endif
+
+extern uint32 `$INSTANCE_NAME`_ReadTimestamp(void);
+extern uint32 `$INSTANCE_NAME`_ReadCount(void);
+
+#endif // NTANTIMESTAMP_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
@@ -0,0 +1,24 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+uint8 `$INSTANCE_NAME`_ReadValue(void) {
+    return `$INSTANCE_NAME`_OUTPUT_REG;
+}
+
+// Reading clears FERR and OVR.
+uint8 `$INSTANCE_NAME`_ReadStatus(void) {
+    return `$INSTANCE_NAME`_STATUS_REG;
+}
+
+/* [] END OF FILE */
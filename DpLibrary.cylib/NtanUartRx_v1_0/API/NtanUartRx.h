@@ -0,0 +1,34 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANUARTRX_`$INSTANCE_NAME`_H)
+#define NTANUARTRX_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+#define `$INSTANCE_NAME`_OUTPUT_REG (* (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
+#define `$INSTANCE_NAME`_OUTPUT_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
+
+// Status register
+// FERR and OVR stay set from the error until the register is read.
+#define `$INSTANCE_NAME`_STATUS_REG (* (reg8 *)`$INSTANCE_NAME`_stsreg__STATUS_REG)
+#define `$INSTANCE_NAME`_STATUS_PTR (  (reg8 *)`$INSTANCE_NAME`_stsreg__STATUS_REG)
+#define `$INSTANCE_NAME`_STS_DREQ   (0x01u)
+#define `$INSTANCE_NAME`_STS_FERR   (0x02u)
+#define `$INSTANCE_NAME`_STS_OVR    (0x04u)
+
+extern uint8 `$INSTANCE_NAME`_ReadValue(void);
+extern uint8 `$INSTANCE_NAME`_ReadStatus(void);
+
+#endif // NTANUARTRX_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
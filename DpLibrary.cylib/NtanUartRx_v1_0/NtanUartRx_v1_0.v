@@ -0,0 +1,279 @@
+
+//`#start header` -- edit after this line, do not edit this line
+// ========================================
+//
+// Copyright YOUR COMPANY, THE YEAR
+// All Rights Reserved
+// UNPUBLISHED, LICENSED SOFTWARE.
+//
+// CONFIDENTIAL AND PROPRIETARY INFORMATION
+// WHICH IS THE PROPERTY OF your company.
+//
+// ========================================
+`include "cypress.v"
+//`#end` -- edit above this line, do not edit this line
+// Generated on 10/19/2026 at 11:42
+// Component: NtanUartRx_v1_0
+module NtanUartRx_v1_0 (
+	output  dreq,
+	output  ferr,
+	output  ovr,
+	input   clock,
+	input   reset,
+	input   rx
+);
+
+//`#start body` -- edit after this line, do not edit this line
+
+// The clock is 8 times the bit rate.
+// A start bit is confirmed at its middle and every following
+// bit is sampled 8 clocks later, in the middle of the bit.
+// FERR and OVR are pulses of a clock.  They are also latched in
+// the status register until it is read, so the CPU can poll them.
+
+// State code declaration
+localparam      ST_IDLE     = 2'b00;
+localparam      ST_START    = 2'b01;
+localparam      ST_DATA     = 2'b11;
+localparam      ST_STOP     = 2'b10;
+
+// Sampling point declaration
+localparam      OV_HALF     = 3'd3;     // Middle of the start bit
+localparam      OV_FULL     = 3'd7;     // Middle of the next bit
+
+// Status register bits
+localparam      STS_DREQ    = 0;
+localparam      STS_FERR    = 1;        // Sticky
+localparam      STS_OVR     = 2;        // Sticky
+
+// Datapath function
+localparam      CS_IDLE     = 3'b000;
+localparam      CS_SR       = 3'b001;
+
+// Wire declaration
+wire[1:0]       state;          // State code
+wire            f0_not_empty;   // F0 is NOT EMPTY
+wire            f0_full;        // F0 is FULL
+wire            sample;         // Sampling point in a bit
+
+// Pseudo register
+reg[2:0]        addr;           // Datapath function
+reg             f0_load;        // Push A0 into F0
+
+// Input synchronizer
+reg[1:0]        rx_sync;        // Double DFF for the RX input
+wire            rx_bit = rx_sync[1];
+
+// Bit timing
+reg[2:0]        ovs;            // Oversampling counter
+reg[2:0]        nbit;           // Data bit counter
+
+// Status pulses
+reg             ferr_reg;       // Framing error
+reg             ovr_reg;        // Overrun
+
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        rx_sync <= 2'b11;
+    end else begin
+        rx_sync <= {rx_sync[0], rx};
+    end
+end
+
+assign      sample = (state == ST_START) ? (ovs == OV_HALF) : (ovs == OV_FULL);
+
+// State machine behavior
+reg [1:0]       state_reg;
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        state_reg <= ST_IDLE;
+        ovs <= 3'd0;
+        nbit <= 3'd0;
+    end else casez (state)
+        ST_IDLE: begin      // Wait for a falling edge
+            ovs <= 3'd0;
+            if (~rx_bit) begin
+                state_reg <= ST_START;
+            end
+        end
+        ST_START: begin     // Confirm the START bit
+            if (sample) begin
+                ovs <= 3'd0;
+                nbit <= 3'd0;
+                if (~rx_bit) begin
+                    state_reg <= ST_DATA;
+                end else begin
+                    state_reg <= ST_IDLE;   // Glitch
+                end
+            end else begin
+                ovs <= ovs + 3'd1;
+            end
+        end
+        ST_DATA: begin      // Shift in eight data bits
+            ovs <= ovs + 3'd1;
+            if (sample) begin
+                nbit <= nbit + 3'd1;
+                if (nbit == 3'd7) begin
+                    state_reg <= ST_STOP;
+                end
+            end
+        end
+        ST_STOP: begin      // Check the STOP bit
+            ovs <= ovs + 3'd1;
+            if (sample) begin
+                state_reg <= ST_IDLE;
+            end
+        end
+        default: begin      // Unidentified state
+            state_reg <= ST_IDLE;
+        end
+    endcase
+end
+assign      state = state_reg;
+
+// Internal control signals
+always @(state or sample) begin
+    casez (state)
+        ST_DATA: begin
+            addr = (sample) ? CS_SR : CS_IDLE;
+            f0_load = 1'b0;
+        end
+        ST_STOP: begin
+            addr = CS_IDLE;
+            f0_load = sample;
+        end
+        default: begin
+            addr = CS_IDLE;
+            f0_load = 1'b0;
+        end
+    endcase
+end
+
+// Status flag behavior
+// A byte is pushed even with a framing error.
+// A byte is lost when the FIFO is FULL.
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+        ferr_reg <= 1'b0;
+        ovr_reg <= 1'b0;
+    end else begin
+        ferr_reg <= f0_load & ~rx_bit;
+        ovr_reg <= f0_load & f0_full;
+    end
+end
+assign      ferr = ferr_reg;
+assign      ovr = ovr_reg;
+
+// Assert Data REQuest if F0 is NOT EMPTY
+assign      dreq = f0_not_empty;
+
+// Status register for polling, FERR and OVR cleared on read
+cy_psoc3_status #(.cy_force_order(1), .cy_md_select(8'h06)) stsreg(
+    /* input          */ .clock(clock),
+    /* input  [07:00] */ .status({5'b0, ovr, ferr, dreq})
+);
+
+cy_psoc3_dp #(.cy_dpconfig(
+{
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP___SR, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: SR: A0 <= {rx, A0 >> 1}*/
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM2:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM4:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM5:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM6:  */
+    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
+    `CS_CMP_SEL_CFGA, /*CFGRAM7:  */
+    8'hFF, 8'h00,  /*CFG9:  */
+    8'hFF, 8'hFF,  /*CFG11-10:  */
+    `SC_CMPB_A1_D1, `SC_CMPA_A1_D1, `SC_CI_B_ARITH,
+    `SC_CI_A_ARITH, `SC_C1_MASK_DSBL, `SC_C0_MASK_DSBL,
+    `SC_A_MASK_DSBL, `SC_DEF_SI_0, `SC_SI_B_DEFSI,
+    `SC_SI_A_ROUTE, /*CFG13-12:  */
+    `SC_A0_SRC_ACC, `SC_SHIFT_SR, 1'h0,
+    1'h0, `SC_FIFO1_BUS, `SC_FIFO0__A0,
+    `SC_MSB_DSBL, `SC_MSB_BIT0, `SC_MSB_NOCHN,
+    `SC_FB_NOCHN, `SC_CMP1_NOCHN,
+    `SC_CMP0_NOCHN, /*CFG15-14:  */
+    10'h00, `SC_FIFO_CLK__DP,`SC_FIFO_CAP_AX,
+    `SC_FIFO_LEVEL,`SC_FIFO__SYNC,`SC_EXTCRC_DSBL,
+    `SC_WRK16CAT_DSBL /*CFG17-16:  */
+}
+)) dp(
+        /*  input                   */  .reset(reset),
+        /*  input                   */  .clk(clock),
+        /*  input   [02:00]         */  .cs_addr(addr[2:0]),
+        /*  input                   */  .route_si(rx_bit),
+        /*  input                   */  .route_ci(1'b0),
+        /*  input                   */  .f0_load(f0_load),
+        /*  input                   */  .f1_load(1'b0),
+        /*  input                   */  .d0_load(1'b0),
+        /*  input                   */  .d1_load(1'b0),
+        /*  output                  */  .ce0(),
+        /*  output                  */  .cl0(),
+        /*  output                  */  .z0(),
+        /*  output                  */  .ff0(),
+        /*  output                  */  .ce1(),
+        /*  output                  */  .cl1(),
+        /*  output                  */  .z1(),
+        /*  output                  */  .ff1(),
+        /*  output                  */  .ov_msb(),
+        /*  output                  */  .co_msb(),
+        /*  output                  */  .cmsb(),
+        /*  output                  */  .so(),
+        /*  output                  */  .f0_bus_stat(f0_not_empty),
+        /*  output                  */  .f0_blk_stat(f0_full),
+        /*  output                  */  .f1_bus_stat(),
+        /*  output                  */  .f1_blk_stat(),
+
+        /* input                    */  .ci(1'b0),     // Carry in from previous stage
+        /* output                   */  .co(),         // Carry out to next stage
+        /* input                    */  .sir(1'b0),    // Shift in from right side
+        /* output                   */  .sor(),        // Shift out to right side
+        /* input                    */  .sil(1'b0),    // Shift in from left side
+        /* output                   */  .sol(),        // Shift out to left side
+        /* input                    */  .msbi(1'b0),   // MSB chain in
+        /* output                   */  .msbo(),       // MSB chain out
+        /* input [01:00]            */  .cei(2'b0),    // Compare equal in from prev stage
+        /* output [01:00]           */  .ceo(),        // Compare equal out to next stage
+        /* input [01:00]            */  .cli(2'b0),    // Compare less than in from prv stage
+        /* output [01:00]           */  .clo(),        // Compare less than out to next stage
+        /* input [01:00]            */  .zi(2'b0),     // Zero detect in from previous stage
+        /* output [01:00]           */  .zo(),         // Zero detect out to next stage
+        /* input [01:00]            */  .fi(2'b0),     // 0xFF detect in from previous stage
+        /* output [01:00]           */  .fo(),         // 0xFF detect out to next stage
+        /* input [01:00]            */  .capi(2'b0),   // Software capture from previous stage
+        /* output [01:00]           */  .capo(),       // Software capture to next stage
+        /* input                    */  .cfbi(1'b0),   // CRC Feedback in from previous stage
+        /* output                   */  .cfbo(),       // CRC Feedback out to next stage
+        /* input [07:00]            */  .pi(8'b0),     // Parallel data port
+        /* output [07:00]           */  .po()          // Parallel data port
+);
+//`#end` -- edit above this line, do not edit this line
+endmodule
+//`#start footer` -- edit after this line, do not edit this line
+//`#end` -- edit above this line, do not edit this line
+
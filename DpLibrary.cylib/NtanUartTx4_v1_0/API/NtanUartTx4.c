@@ -0,0 +1,30 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "`$INSTANCE_NAME`.h"
+
+static reg8 * const `$INSTANCE_NAME`_inputPtr[`$INSTANCE_NAME`_CHANNELS] = {
+    `$INSTANCE_NAME`_INPUT0_PTR,
+    `$INSTANCE_NAME`_INPUT1_PTR,
+    `$INSTANCE_NAME`_INPUT2_PTR,
+    `$INSTANCE_NAME`_INPUT3_PTR
+};
+
+void `$INSTANCE_NAME`_WriteValue(uint8 channel, uint8 value) {
+    *`$INSTANCE_NAME`_inputPtr[channel & 3u] = value;
+}
+
+reg8 *`$INSTANCE_NAME`_InputPtr(uint8 channel) {
+    return `$INSTANCE_NAME`_inputPtr[channel & 3u];
+}
+
+/* [] END OF FILE */
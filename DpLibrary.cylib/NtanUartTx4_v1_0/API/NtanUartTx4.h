@@ -0,0 +1,35 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANUARTTX4_`$INSTANCE_NAME`_H)
+#define NTANUARTTX4_`$INSTANCE_NAME`_H
+    
+#include <cytypes.h>
+
+#define `$INSTANCE_NAME`_CHANNELS (4u)
+
+// Channel 0 and 1 share dp_lo, channel 2 and 3 share dp_hi
+#define `$INSTANCE_NAME`_INPUT0_REG (* (reg8 *)`$INSTANCE_NAME`_dp_lo__F0_REG)
+#define `$INSTANCE_NAME`_INPUT0_PTR (  (reg8 *)`$INSTANCE_NAME`_dp_lo__F0_REG)
+#define `$INSTANCE_NAME`_INPUT1_REG (* (reg8 *)`$INSTANCE_NAME`_dp_lo__F1_REG)
+#define `$INSTANCE_NAME`_INPUT1_PTR (  (reg8 *)`$INSTANCE_NAME`_dp_lo__F1_REG)
+#define `$INSTANCE_NAME`_INPUT2_REG (* (reg8 *)`$INSTANCE_NAME`_dp_hi__F0_REG)
+#define `$INSTANCE_NAME`_INPUT2_PTR (  (reg8 *)`$INSTANCE_NAME`_dp_hi__F0_REG)
+#define `$INSTANCE_NAME`_INPUT3_REG (* (reg8 *)`$INSTANCE_NAME`_dp_hi__F1_REG)
+#define `$INSTANCE_NAME`_INPUT3_PTR (  (reg8 *)`$INSTANCE_NAME`_dp_hi__F1_REG)
+
+extern void `$INSTANCE_NAME`_WriteValue(uint8 channel, uint8 value);
+extern reg8 *`$INSTANCE_NAME`_InputPtr(uint8 channel);
+
+#endif // NTANUARTTX4_`$INSTANCE_NAME`_H
+
+/* [] END OF FILE */
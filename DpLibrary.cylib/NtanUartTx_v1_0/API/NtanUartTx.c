@@ -12,8 +12,134 @@
 
 #include "`$INSTANCE_NAME`.h"
 
+#if (`$INSTANCE_NAME`_DATA_BITS != 9u)
+static uint8 `$INSTANCE_NAME`_channel = CY_DMA_INVALID_CHANNEL;
+static uint8 `$INSTANCE_NAME`_td[`$INSTANCE_NAME`_MAX_SEGMENTS];
+static uint16 `$INSTANCE_NAME`_upper[`$INSTANCE_NAME`_MAX_SEGMENTS];
+static uint8 `$INSTANCE_NAME`_nTds;      // TDs allocated
+static uint8 `$INSTANCE_NAME`_count;     // Segments of the packet
+static uint8 `$INSTANCE_NAME`_next;      // First segment of the next run
+#endif
+
 void `$INSTANCE_NAME`_WriteValue(uint8 value) {
     `$INSTANCE_NAME`_INPUT_REG = value;
 }
 
+#if (`$INSTANCE_NAME`_DATA_BITS == 9u)
+void `$INSTANCE_NAME`_WriteValue9(uint16 value) {
+    `$INSTANCE_NAME`_INPUT9_REG = (uint8)(value >> 8);
+    `$INSTANCE_NAME`_INPUT_REG = (uint8)value;
+}
+#endif
+
+#if (`$INSTANCE_NAME`_CHECKSUM != `$INSTANCE_NAME`_CHECKSUM_NONE) && (`$INSTANCE_NAME`_DATA_BITS != 9u)
+// A character is added when it is loaded from F0,
+// so the checksum is complete once the FIFO is empty.
+uint8 `$INSTANCE_NAME`_ReadChecksum(void) {
+    return `$INSTANCE_NAME`_CHECKSUM_REG;
+}
+
+// Clear before writing the first character of a packet.
+void `$INSTANCE_NAME`_ClearChecksum(void) {
+    `$INSTANCE_NAME`_CHECKSUM_REG = 0u;
+}
+#endif
+
+#if (`$INSTANCE_NAME`_DATA_BITS != 9u)
+// Start the run from the next segment
+// Called with the interrupts disabled
+static void `$INSTANCE_NAME`_StartRun(void) {
+    uint8 first = `$INSTANCE_NAME`_next;
+    uint16 upper = `$INSTANCE_NAME`_upper[first];
+    while (`$INSTANCE_NAME`_next < `$INSTANCE_NAME`_count
+            && `$INSTANCE_NAME`_upper[`$INSTANCE_NAME`_next] == upper) {
+        `$INSTANCE_NAME`_next++;
+    }
+    CyDmaChSetExtendedAddress(`$INSTANCE_NAME`_channel, upper, HI16(CYDEV_PERIPH_BASE));
+    CyDmaChSetInitialTd(`$INSTANCE_NAME`_channel, `$INSTANCE_NAME`_td[first]);
+    CyDmaChEnable(`$INSTANCE_NAME`_channel, 1u);
+}
+
+// Send a packet made of segments.
+// The segments must stay untouched until Busy() returns 0,
+// but the list itself may be reused once Send() returns.
+cystatus `$INSTANCE_NAME`_Send(uint8 channel,
+        const `$INSTANCE_NAME`_segment segments[], uint8 count) {
+    uint8 n;
+    uint8 intState;
+    if (channel == CY_DMA_INVALID_CHANNEL
+            || count == 0u || count > `$INSTANCE_NAME`_MAX_SEGMENTS) {
+        return CYRET_BAD_PARAM;
+    }
+    for (n = 0u; n < count; n++) {
+        if (segments[n].bytes == 0u || segments[n].bytes > `$INSTANCE_NAME`_SEGMENT_MAX) {
+            return CYRET_BAD_PARAM;
+        }
+        // A TD does not carry over into the next 64KB
+        if (HI16((uint32)segments[n].data)
+                != HI16((uint32)segments[n].data + segments[n].bytes - 1u)) {
+            return CYRET_BAD_PARAM;
+        }
+    }
+    if (`$INSTANCE_NAME`_Busy()) {
+        return CYRET_INVALID_STATE;
+    }
+
+    // TDs are kept for the next packet
+    while (`$INSTANCE_NAME`_nTds < count) {
+        uint8 td = CyDmaTdAllocate();
+        if (td == CY_DMA_INVALID_TD) {
+            return CYRET_INVALID_STATE;
+        }
+        `$INSTANCE_NAME`_td[`$INSTANCE_NAME`_nTds++] = td;
+    }
+
+    for (n = 0u; n < count; n++) {
+        uint32 src = (uint32)segments[n].data;
+        uint8 last = (n + 1u == count)
+            || (HI16(src) != HI16((uint32)segments[n + 1u].data));
+        `$INSTANCE_NAME`_upper[n] = HI16(src);
+        CyDmaTdSetConfiguration(`$INSTANCE_NAME`_td[n], segments[n].bytes,
+            last ? CY_DMA_DISABLE_TD : `$INSTANCE_NAME`_td[n + 1u],
+            last ? (CY_DMA_TD_INC_SRC_ADR | CY_DMA_TD_TERMOUT0_EN) : CY_DMA_TD_INC_SRC_ADR);
+        CyDmaTdSetAddress(`$INSTANCE_NAME`_td[n],
+            LO16(src), LO16((uint32)`$INSTANCE_NAME`_INPUT_PTR));
+    }
+    intState = CyEnterCriticalSection();
+    `$INSTANCE_NAME`_channel = channel;
+    `$INSTANCE_NAME`_count = count;
+    `$INSTANCE_NAME`_next = 0u;
+    `$INSTANCE_NAME`_StartRun();
+    CyExitCriticalSection(intState);
+    return CYRET_SUCCESS;
+}
+
+// Start the next run when the DMA has finished the previous one
+void `$INSTANCE_NAME`_Poll(void) {
+    uint8 state;
+    uint8 intState = CyEnterCriticalSection();
+    if (`$INSTANCE_NAME`_next < `$INSTANCE_NAME`_count) {
+        CyDmaChStatus(`$INSTANCE_NAME`_channel, NULL, &state);
+        if (!(state & CY_DMA_STATUS_CHAIN_ACTIVE)) {
+            `$INSTANCE_NAME`_StartRun();
+        }
+    }
+    CyExitCriticalSection(intState);
+}
+
+// 1 while a packet is moved to the FIFO.
+// The last characters are still in the FIFO and the shifter.
+uint8 `$INSTANCE_NAME`_Busy(void) {
+    uint8 state = 0u;
+    uint8 intState = CyEnterCriticalSection();
+    if (`$INSTANCE_NAME`_next < `$INSTANCE_NAME`_count) {
+        state = CY_DMA_STATUS_CHAIN_ACTIVE;
+    } else if (`$INSTANCE_NAME`_channel != CY_DMA_INVALID_CHANNEL) {
+        CyDmaChStatus(`$INSTANCE_NAME`_channel, NULL, &state);
+    }
+    CyExitCriticalSection(intState);
+    return (state & CY_DMA_STATUS_CHAIN_ACTIVE) ? 1u : 0u;
+}
+#endif
+
 /* [] END OF FILE */
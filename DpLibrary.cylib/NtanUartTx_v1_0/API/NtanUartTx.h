@@ -14,11 +14,72 @@
 #define NTANUARTTX_`$INSTANCE_NAME`_H
     
 #include <cytypes.h>
+#include <CyDmac.h>
+#include <CyLib.h>
+
+// Frame format
+#define `$INSTANCE_NAME`_DATA_BITS  (`$DataBits`u)
+#define `$INSTANCE_NAME`_PARITY     (`$Parity`u)
+#define `$INSTANCE_NAME`_STOP_BITS  (`$StopBits`u)
+#define `$INSTANCE_NAME`_CHECKSUM   (`$Checksum`u)
+
+#define `$INSTANCE_NAME`_PARITY_NONE    (0u)
+#define `$INSTANCE_NAME`_PARITY_EVEN    (1u)
+#define `$INSTANCE_NAME`_PARITY_ODD     (2u)
+#define `$INSTANCE_NAME`_PARITY_MARK    (3u)
+#define `$INSTANCE_NAME`_PARITY_SPACE   (4u)
+
+#define `$INSTANCE_NAME`_CHECKSUM_NONE  (0u)
+#define `$INSTANCE_NAME`_CHECKSUM_SUM   (1u)
+#define `$INSTANCE_NAME`_CHECKSUM_XOR   (2u)
 
 #define `$INSTANCE_NAME`_INPUT_REG (* (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
 #define `$INSTANCE_NAME`_INPUT_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__F0_REG)
+// Bit 8 of a 9-bit character
+#define `$INSTANCE_NAME`_INPUT9_REG (* (reg8 *)`$INSTANCE_NAME`_dp__F1_REG)
+#define `$INSTANCE_NAME`_INPUT9_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__F1_REG)
+// Running checksum of characters loaded from F0
+// A1 holds bit 8 instead with 9 data bits, so no checksum then.
+#define `$INSTANCE_NAME`_CHECKSUM_REG (* (reg8 *)`$INSTANCE_NAME`_dp__A1_REG)
+#define `$INSTANCE_NAME`_CHECKSUM_PTR (  (reg8 *)`$INSTANCE_NAME`_dp__A1_REG)
+
+// Segment list transmit
+//
+// A packet is sent by DMA from a list of segments in flash or
+// SRAM with a TD per segment, without copying them into a buffer.
+// The channel is set up by its DmaInitialize() for a byte per
+// burst with a request per burst.  A TD reaches the 64KB of the
+// upper source address of the channel only, so the list is sent
+// in runs of segments sharing it, flash and SRAM being in
+// different ones.  A segment must not cross a 64KB boundary.
+// The next run is started by Poll(), which can be called from
+// the interrupt on nrq of the DMA, raised at the end of every run.
+// A character takes two bytes in F1 and F0 with 9 data bits, so
+// the segments are not available then.
+#if (`$INSTANCE_NAME`_DATA_BITS != 9u)
+#define `$INSTANCE_NAME`_MAX_SEGMENTS   (8u)
+#define `$INSTANCE_NAME`_SEGMENT_MAX    (4095u)
+
+typedef struct {
+    const volatile void *data;
+    uint16      bytes;
+} `$INSTANCE_NAME`_segment;
+#endif
 
 extern void `$INSTANCE_NAME`_WriteValue(uint8 value);
+#if (`$INSTANCE_NAME`_DATA_BITS == 9u)
+extern void `$INSTANCE_NAME`_WriteValue9(uint16 value);
+#endif
+#if (`$INSTANCE_NAME`_CHECKSUM != `$INSTANCE_NAME`_CHECKSUM_NONE) && (`$INSTANCE_NAME`_DATA_BITS != 9u)
+extern uint8 `$INSTANCE_NAME`_ReadChecksum(void);
+extern void `$INSTANCE_NAME`_ClearChecksum(void);
+#endif
+#if (`$INSTANCE_NAME`_DATA_BITS != 9u)
+extern cystatus `$INSTANCE_NAME`_Send(uint8 channel,
+    const `$INSTANCE_NAME`_segment segments[], uint8 count);
+extern void `$INSTANCE_NAME`_Poll(void);
+extern uint8 `$INSTANCE_NAME`_Busy(void);
+#endif
 
 #endif // NTANUARTTX_`$INSTANCE_NAME`_H
 
@@ -12,77 +12,138 @@
 // ========================================
 `include "cypress.v"
 //`#end` -- edit above this line, do not edit this line
-// Generated on 08/22/2019 at 15:41
+// Generated on 10/19/2026 at 11:46
 // Component: NtanUartTx_v1_0
 module NtanUartTx_v1_0 (
 	output  dreq,
+	output  item,
 	output  tx,
 	input   clock,
 	input   reset
 );
+	parameter Checksum = 0;
+	parameter DataBits = 8;
+	parameter Parity = 0;
+	parameter StopBits = 1;
 
 //`#start body` -- edit after this line, do not edit this line
 
 // State code declaration
-localparam      ST_IDLE     = 4'b0000;
-localparam      ST_START    = 4'b0100;
-localparam      ST_SHIFT0   = 4'b1000;
-localparam      ST_SHIFT1   = 4'b1001;
-localparam      ST_SHIFT2   = 4'b1010;
-localparam      ST_SHIFT3   = 4'b1011;
-localparam      ST_SHIFT4   = 4'b1100;
-localparam      ST_SHIFT5   = 4'b1101;
-localparam      ST_SHIFT6   = 4'b1110;
-localparam      ST_SHIFT7   = 4'b1111;
-localparam      ST_STOP     = 4'b0001;
+localparam      ST_IDLE     = 3'b000;
+localparam      ST_START    = 3'b001;
+localparam      ST_SHIFT    = 3'b010;
+localparam      ST_BIT8     = 3'b011;
+localparam      ST_PARITY   = 3'b100;
+localparam      ST_STOP1    = 3'b101;
+localparam      ST_STOP2    = 3'b110;
+
+// Parity declaration
+localparam      PARITY_NONE = 0;
+localparam      PARITY_EVEN = 1;
+localparam      PARITY_ODD  = 2;
+localparam      PARITY_MARK = 3;
+localparam      PARITY_SPACE = 4;
+
+// Checksum declaration
+localparam      CHECKSUM_NONE = 0;
+localparam      CHECKSUM_SUM = 1;
+localparam      CHECKSUM_XOR = 2;
+
+// Frame format
+// Bit 8 of a 9-bit character is written into F1 and sent from A1.
+localparam      NINE_BITS   = (DataBits == 9);
+localparam [2:0] LAST_A0_BIT = (NINE_BITS) ? 3'd7 : (DataBits - 1);
+localparam [1:0] A1_LOAD    = (NINE_BITS) ? `CS_A1_SRC___F1 : `CS_A1_SRC_NONE;
+
+// Checksum accumulated in A1, not available for 9-bit characters
+localparam      USE_CHECKSUM = (Checksum != CHECKSUM_NONE) && !NINE_BITS;
+localparam [2:0] SUM_OP     = (Checksum == CHECKSUM_XOR) ? `CS_ALU_OP__XOR : `CS_ALU_OP__ADD;
+localparam [1:0] A1_SUM     = (USE_CHECKSUM) ? `CS_A1_SRC__ALU : `CS_A1_SRC_NONE;
 
 // Datapath function
 localparam      CS_IDLE     = 3'b000;
 localparam      CS_LOAD     = 3'b001;
 localparam      CS_SR       = 3'b010;
+localparam      CS_SR_B     = 3'b011;
+localparam      CS_SUM      = 3'b100;
 
 // Wire declaration
-wire[3:0]       state;          // State code
+wire[2:0]       state;          // State code
 wire            f0_empty;       // F0 is EMPTY
 wire            f0_not_full;    // F0 is not FULL
+wire            f1_empty;       // F1 is EMPTY
+wire            f1_not_full;    // F1 is not FULL
 wire            so;             // Shift out
+wire            ready;          // A character is ready in FIFO
+wire            load;           // Load a character into A0
+wire            last_bit;       // Last bit in A0
+wire            parity_bit;     // Parity bit to be sent
 
 // Pseudo register
 reg[2:0]        addr;           // MSB part of Datapath function
 
+// Bit counter and parity accumulator
+reg[2:0]        nbit;           // Bit position in A0
+reg             parity_reg;     // XOR of bits sent
+
 // Output signal buffer
 reg             tx_reg;         // DFF for output
 
+assign      ready = ~f0_empty & (~NINE_BITS | ~f1_empty);
+assign      last_bit = (nbit == LAST_A0_BIT);
+// The character is loaded one bit time before START
+// to leave the ALU free for the checksum.
+assign      load = ready & (
+                (state == ST_IDLE)
+            |   ((state == ST_STOP1) & (StopBits != 2))
+            |   (state == ST_STOP2)
+            );
+
 // State machine behavior
-reg [3:0]       state_reg;
+reg [2:0]       state_reg;
 always @(posedge reset or posedge clock) begin
     if (reset) begin
                 state_reg <= ST_IDLE;
+                nbit <= 3'd0;
     end else casez (state)
         ST_IDLE:
-            if (~f0_empty) begin
+            if (ready) begin
                 state_reg <= ST_START;
             end
-        ST_START:
-                state_reg <= ST_SHIFT0;
-        ST_SHIFT0:
-                state_reg <= ST_SHIFT1;
-        ST_SHIFT1:
-                state_reg <= ST_SHIFT2;
-        ST_SHIFT2:
-                state_reg <= ST_SHIFT3;
-        ST_SHIFT3:
-                state_reg <= ST_SHIFT4;
-        ST_SHIFT4:
-                state_reg <= ST_SHIFT5;
-        ST_SHIFT5:
-                state_reg <= ST_SHIFT6;
-        ST_SHIFT6:
-                state_reg <= ST_SHIFT7;
-        ST_SHIFT7:
-                state_reg <= ST_STOP;
-        ST_STOP:
-            if (~f0_empty) begin
+        ST_START: begin
+                state_reg <= ST_SHIFT;
+                nbit <= 3'd0;
+        end
+        ST_SHIFT: begin
+                nbit <= nbit + 3'd1;
+            if (last_bit) begin
+                if (NINE_BITS) begin
+                    state_reg <= ST_BIT8;
+                end else if (Parity != PARITY_NONE) begin
+                    state_reg <= ST_PARITY;
+                end else begin
+                    state_reg <= ST_STOP1;
+                end
+            end
+        end
+        ST_BIT8:
+            if (Parity != PARITY_NONE) begin
+                state_reg <= ST_PARITY;
+            end else begin
+                state_reg <= ST_STOP1;
+            end
+        ST_PARITY:
+                state_reg <= ST_STOP1;
+        ST_STOP1:
+            if (StopBits == 2) begin
+                state_reg <= ST_STOP2;
+            end else if (ready) begin
+                state_reg <= ST_START;
+            end else begin
+                state_reg <= ST_IDLE;
+            end
+        ST_STOP2:
+            if (ready) begin
                 state_reg <= ST_START;
             end else begin
                 state_reg <= ST_IDLE;
@@ -94,20 +155,19 @@ end
 assign      state = state_reg;
 
 // Internal control signals
-always @(state) begin
+always @(state or load) begin
     casez (state)
-        ST_IDLE: begin
-            addr    = CS_IDLE;
+        ST_IDLE, ST_STOP1, ST_STOP2: begin
+            addr    = (load) ? CS_LOAD : CS_IDLE;
         end
         ST_START: begin
-            addr    = CS_LOAD;
+            addr    = CS_SUM;
         end
-        ST_SHIFT0, ST_SHIFT1, ST_SHIFT2, ST_SHIFT3,
-        ST_SHIFT4, ST_SHIFT5, ST_SHIFT6, ST_SHIFT7: begin
+        ST_SHIFT: begin
             addr    = CS_SR;
         end
-        ST_STOP: begin
-            addr    = CS_IDLE;
+        ST_BIT8: begin
+            addr    = CS_SR_B;
         end
         default: begin
             addr    = CS_IDLE;
@@ -115,6 +175,25 @@ always @(state) begin
     endcase
 end
 
+// Parity behavior
+// Accumulate the XOR of the data bits while they are shifted out.
+always @(posedge reset or posedge clock) begin
+    if (reset) begin
+            parity_reg <= 1'b0;
+    end else casez (state)
+        ST_START:
+            parity_reg <= 1'b0;
+        ST_SHIFT, ST_BIT8:
+            parity_reg <= parity_reg ^ so;
+        default:
+            parity_reg <= parity_reg;
+    endcase
+end
+assign parity_bit = (Parity == PARITY_EVEN) ?  parity_reg
+                  : (Parity == PARITY_ODD)  ? ~parity_reg
+                  : (Parity == PARITY_MARK) ?  1'b1
+                  : 1'b0;
+
 // TX output behavior
 // Implemented in negative logic
 always @(posedge reset or posedge clock) begin
@@ -125,10 +204,11 @@ always @(posedge reset or posedge clock) begin
             tx_reg <= 1'b0;  // MARK
         ST_START:
             tx_reg <= 1'b1;  // SPACE
-        ST_SHIFT0, ST_SHIFT1, ST_SHIFT2, ST_SHIFT3,
-        ST_SHIFT4, ST_SHIFT5, ST_SHIFT6, ST_SHIFT7:
+        ST_SHIFT, ST_BIT8:
             tx_reg <= ~so;
-        ST_STOP:
+        ST_PARITY:
+            tx_reg <= ~parity_bit;
+        ST_STOP1, ST_STOP2:
             tx_reg <= 1'b0;  // MARK
         default:
             tx_reg <= 1'b0;  // MARK
@@ -136,8 +216,14 @@ always @(posedge reset or posedge clock) begin
 end
 assign tx = ~tx_reg;
 
+// ITEM output behavior
+// HIGH for a clock as a character is loaded from the FIFO,
+// to count the characters on a PerfCounter.
+assign item = load;
+
 // DREQ output behavior
-assign dreq = f0_not_full;
+// Both FIFOs must accept a 9-bit character.
+assign dreq = f0_not_full & (~NINE_BITS | f1_not_full);
 
 cy_psoc3_dp #(.cy_dpconfig(
 {
@@ -146,21 +232,21 @@ cy_psoc3_dp #(.cy_dpconfig(
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
     `CS_CMP_SEL_CFGA, /*CFGRAM0: IDLE*/
     `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
-    `CS_SHFT_OP_PASS, `CS_A0_SRC___F0, `CS_A1_SRC_NONE,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC___F0, A1_LOAD,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
-    `CS_CMP_SEL_CFGA, /*CFGRAM1: LOAD - A0 <= F0*/
+    `CS_CMP_SEL_CFGA, /*CFGRAM1: LOAD - A0 <= F0, A1 <= F1 for 9 bits*/
     `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
     `CS_SHFT_OP___SR, `CS_A0_SRC__ALU, `CS_A1_SRC_NONE,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
     `CS_CMP_SEL_CFGA, /*CFGRAM2: SR: A0 <= A0 >> 1*/
-    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
-    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_ALU_OP_PASS, `CS_SRCA_A1, `CS_SRCB_D0,
+    `CS_SHFT_OP___SR, `CS_A0_SRC_NONE, `CS_A1_SRC__ALU,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
-    `CS_CMP_SEL_CFGA, /*CFGRAM3:  */
-    `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
-    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
+    `CS_CMP_SEL_CFGA, /*CFGRAM3: SR_B: A1 <= A1 >> 1*/
+    SUM_OP, `CS_SRCA_A1, `CS_SRCB_A0,
+    `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, A1_SUM,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
-    `CS_CMP_SEL_CFGA, /*CFGRAM4:  */
+    `CS_CMP_SEL_CFGA, /*CFGRAM4: SUM: A1 <= A1 + A0 or A1 ^ A0*/
     `CS_ALU_OP_PASS, `CS_SRCA_A0, `CS_SRCB_D0,
     `CS_SHFT_OP_PASS, `CS_A0_SRC_NONE, `CS_A1_SRC_NONE,
     `CS_FEEDBACK_DSBL, `CS_CI_SEL_CFGA, `CS_SI_SEL_CFGA,
@@ -212,8 +298,8 @@ cy_psoc3_dp #(.cy_dpconfig(
         /*  output                  */  .so(so),
         /*  output                  */  .f0_bus_stat(f0_not_full),
         /*  output                  */  .f0_blk_stat(f0_empty),
-        /*  output                  */  .f1_bus_stat(),
-        /*  output                  */  .f1_blk_stat(),
+        /*  output                  */  .f1_bus_stat(f1_not_full),
+        /*  output                  */  .f1_blk_stat(f1_empty),
         
         /* input                    */  .ci(1'b0),     // Carry in from previous stage
         /* output                   */  .co(),         // Carry out to next stage
@@ -0,0 +1,109 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// Samples to be sent to Histogram
+// A ramp over 0..255 puts 64 samples into every bin with BinShift=0
+#define SAMPLES     (256u)
+uint8 samples[SAMPLES];
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST 1
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA
+uint8 DMA_Chan;
+uint8 DMA_TD[1];
+
+// Histogram Ready Detection
+volatile CYBIT int_Ready_Flag = 0;
+
+CY_ISR(int_Ready_isr) {
+    int_Ready_Flag = 1;
+}
+
+int main(void) {
+    uint32 i, j;
+    uint32 errors;
+    uint16 bin[Histogram_BINS];
+    uint8 dmaState;
+    char sbuf[80];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nHISTOGRAM TEST\r\n");
+
+    // Prepare the samples
+    for (i = 0; i < SAMPLES; i++) {
+        samples[i] = (uint8)i;
+    }
+
+    // DMA Configuration
+    DMA_Chan = DMA_DmaInitialize(
+        DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST,
+        HI16(DMA_SRC_BASE), HI16(DMA_DST_BASE)
+    );
+    DMA_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(
+        DMA_TD[0],
+        sizeof samples, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR
+    );
+    CyDmaTdSetAddress(DMA_TD[0], LO16((uint32)samples), LO16((uint32)Histogram_INPUT_PTR));
+
+    // Initialize Ready interrupt
+    int_Ready_ClearPending();
+    int_Ready_StartEx(int_Ready_isr);
+
+    for (j = 0; j < 2; j++) {
+        // Clear the bins
+        Histogram_ClearBins();
+        int_Ready_Flag = 0;
+
+        // Trigger DMA
+        CyDmaChSetInitialTd(DMA_Chan, DMA_TD[0]);
+        CyDmaChEnable(DMA_Chan, 1);
+
+        // Wait for all samples sent and counted.
+        // BUSY may fall between samples, so the flag is only
+        // trusted after the DMA is done, and a short delay
+        // covers the samples still in the FIFO.
+        do {
+            CyDmaChStatus(DMA_Chan, NULL, &dmaState);
+        } while (dmaState & CY_DMA_STATUS_CHAIN_ACTIVE);
+        while (!int_Ready_Flag) ;
+        CyDelayUs(1);
+        int_Ready_Flag = 0;
+
+        // Get and check the bins
+        errors = 0;
+        for (i = 0; i < Histogram_BINS; i++) {
+            bin[i] = Histogram_ReadBin((uint8)i);
+            if (bin[i] != SAMPLES / Histogram_BINS) errors++;
+        }
+
+        // Show the bins
+        sprintf(sbuf, "BIN=%u,%u,%u,%u check=%s\r\n",
+            bin[0], bin[1], bin[2], bin[3], errors ? "NG" : "ok");
+        UART_PutString(sbuf);
+    }
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// Words posted by DMA_Post and fetched by int_Avail
+#define WORDS (256u)
+Mailbox_value posted[WORDS];
+Mailbox_value fetched[WORDS];
+volatile uint32 fetchedWords = 0;
+
+// Defines for DMA_Post
+#define DMA_Post_BYTES_PER_BURST (sizeof (Mailbox_value))
+#define DMA_Post_REQUEST_PER_BURST 1
+#define DMA_Post_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_Post_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA_Post
+uint8 DMA_Post_Chan;
+uint8 DMA_Post_TD[1];
+
+// The consumer drains the mailbox while AVAIL is HIGH
+CY_ISR(int_Avail_isr) {
+    Mailbox_value value;
+
+    while (Mailbox_Fetch(&value)) {
+        if (fetchedWords < WORDS) {
+            fetched[fetchedWords] = value;
+        }
+        fetchedWords++;
+    }
+}
+
+// The main-loop
+int main(void)
+{
+    uint32 k;
+    uint32 errors = 0;
+    uint8 dmaState;
+    char sbuf[64];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nMAILBOX TEST\r\n");
+
+    // Prepare the words
+    for (k = 0; k < WORDS; k++) {
+        posted[k] = (Mailbox_value)(k * 2654435761u);
+    }
+
+    // Initialize AVAIL interrupt
+    int_Avail_ClearPending();
+    int_Avail_StartEx(int_Avail_isr);
+
+    // DMA Configuration for DMA_Post
+    DMA_Post_Chan = DMA_Post_DmaInitialize(
+        DMA_Post_BYTES_PER_BURST, DMA_Post_REQUEST_PER_BURST,
+        HI16(DMA_Post_SRC_BASE), HI16(DMA_Post_DST_BASE));
+    DMA_Post_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(DMA_Post_TD[0], sizeof posted, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+    CyDmaTdSetAddress(DMA_Post_TD[0], LO16((uint32)posted), LO16((uint32)Mailbox_INPUT_PTR));
+    CyDmaChSetInitialTd(DMA_Post_Chan, DMA_Post_TD[0]);
+    CyDmaChEnable(DMA_Post_Chan, 1);
+
+    // Wait for all words posted and fetched
+    do {
+        CyDmaChStatus(DMA_Post_Chan, NULL, &dmaState);
+    } while (dmaState & CY_DMA_STATUS_CHAIN_ACTIVE);
+    CyDelay(1);
+
+    for (k = 0; k < WORDS; k++) {
+        if (fetched[k] != posted[k]) errors++;
+    }
+    sprintf(sbuf, "posted=%lu fetched=%lu errors=%lu check=%s\r\n",
+        (uint32)WORDS, fetchedWords, errors,
+        (errors || fetchedWords != WORDS) ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;)
+    {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
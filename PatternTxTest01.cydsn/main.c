@@ -0,0 +1,63 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// Statemachine declaration
+#define ST_IDLE (0)
+#define ST_SEND (1)
+
+uint32 state = ST_IDLE;
+
+// The main-loop
+int main(void)
+{
+    char sbuf[64];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nPATTERNTX TEST\r\n");
+
+    // The counting pattern starts from 0x00
+    PatternTx_WriteCount(0xFFu);
+
+    // Initialize the statemachine task
+    state = ST_IDLE;
+
+    for(;;)
+    {
+        // Statemachine dispatcher
+        // PatternTx sends while SW1 is pushed
+        switch (state) {
+            case ST_IDLE:
+                // Wait for the SW1 pushed
+                if (!Pin_SW1_Read()) {
+                    state = ST_SEND;
+                }
+                break;
+            case ST_SEND:
+                // Wait for the SW1 released
+                if (Pin_SW1_Read()) {
+                    sprintf(sbuf, "last=%02X\r\n", PatternTx_COUNT_REG);
+                    UART_PutString(sbuf);
+                    state = ST_IDLE;
+                }
+                break;
+            default:
+                state = ST_IDLE;
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,75 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// Data packet to be sent
+const char phrase[] = "The quick brown fox jumps over the lazy dog.\r\n";
+#define PACKET_SIZE (sizeof phrase - 1)
+
+// Defines for DMA_UartTx
+#define DMA_UartTx_BYTES_PER_BURST 1
+#define DMA_UartTx_REQUEST_PER_BURST 1
+#define DMA_UartTx_SRC_BASE (CYDEV_FLASH_BASE)
+#define DMA_UartTx_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA_UartTx
+uint8 DMA_UartTx_Chan;
+uint8 DMA_UartTx_TD[1];
+
+// The main-loop
+int main(void)
+{
+    uint32 round = 0;
+    uint32 items;
+    uint8 dmaState;
+    char sbuf[64];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nPERFCOUNTER TEST\r\n");
+
+    // DMA Configuration for DMA_UartTx
+    DMA_UartTx_Chan = DMA_UartTx_DmaInitialize(
+        DMA_UartTx_BYTES_PER_BURST, DMA_UartTx_REQUEST_PER_BURST,
+        HI16(DMA_UartTx_SRC_BASE), HI16(DMA_UartTx_DST_BASE));
+    DMA_UartTx_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(DMA_UartTx_TD[0], PACKET_SIZE, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+    CyDmaTdSetAddress(DMA_UartTx_TD[0], LO16((uint32)phrase), LO16((uint32)UartTx_INPUT_PTR));
+
+    for(;;)
+    {
+        // PerfCounter is always enabled, so clear it while idle
+        PerfCounter_ClearCount();
+
+        // Send a packet until exhausted
+        CyDmaChSetInitialTd(DMA_UartTx_Chan, DMA_UartTx_TD[0]);
+        CyDmaChEnable(DMA_UartTx_Chan, 1);
+        do {
+            CyDmaChStatus(DMA_UartTx_Chan, NULL, &dmaState);
+        } while (dmaState & CY_DMA_STATUS_CHAIN_ACTIVE);
+
+        // Wait for the last characters loaded from the FIFO
+        CyDelay(1);
+
+        // ITEM is HIGH for a clock per character
+        items = PerfCounter_ReadCount();
+        sprintf(sbuf, "round=%lu items=%lu check=%s\r\n",
+            round++, items, (items == PACKET_SIZE) ? "ok" : "NG");
+        UART_PutString(sbuf);
+        CyDelay(500);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// The probe is tied to this constant in the schematic
+#define PROBE_VALUE (0x5Au)
+
+// Rings of the records
+#define RECORDS (256u)
+uint8 value[RECORDS];
+uint8 count[RECORDS];
+
+// Defines for DMA_Value and DMA_Count
+#define DMA_Probe_BYTES_PER_BURST 1
+#define DMA_Probe_REQUEST_PER_BURST 1
+#define DMA_Probe_SRC_BASE (CYDEV_PERIPH_BASE)
+#define DMA_Probe_DST_BASE (CYDEV_SRAM_BASE)
+
+// Variable declarations for DMA_Value and DMA_Count
+uint8 DMA_Value_Chan;
+uint8 DMA_Value_TD[1];
+uint8 DMA_Count_Chan;
+uint8 DMA_Count_TD[1];
+
+// The main-loop
+int main(void)
+{
+    uint32 k;
+    uint32 records = 0;
+    uint32 samples = 0;
+    uint32 errors = 0;
+    char sbuf[80];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nPROBECAPTURE TEST\r\n");
+
+    // DMA Configuration for DMA_Value
+    DMA_Value_Chan = DMA_Value_DmaInitialize(
+        DMA_Probe_BYTES_PER_BURST, DMA_Probe_REQUEST_PER_BURST,
+        HI16(DMA_Probe_SRC_BASE), HI16(DMA_Probe_DST_BASE));
+    DMA_Value_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(DMA_Value_TD[0], sizeof value, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_DST_ADR);
+    CyDmaTdSetAddress(DMA_Value_TD[0], LO16((uint32)ProbeCapture_VALUE_PTR), LO16((uint32)value));
+    CyDmaChSetInitialTd(DMA_Value_Chan, DMA_Value_TD[0]);
+
+    // DMA Configuration for DMA_Count
+    DMA_Count_Chan = DMA_Count_DmaInitialize(
+        DMA_Probe_BYTES_PER_BURST, DMA_Probe_REQUEST_PER_BURST,
+        HI16(DMA_Probe_SRC_BASE), HI16(DMA_Probe_DST_BASE));
+    DMA_Count_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(DMA_Count_TD[0], sizeof count, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_DST_ADR);
+    CyDmaTdSetAddress(DMA_Count_TD[0], LO16((uint32)ProbeCapture_COUNT_PTR), LO16((uint32)count));
+    CyDmaChSetInitialTd(DMA_Count_Chan, DMA_Count_TD[0]);
+
+    CyDmaChEnable(DMA_Value_Chan, 1);
+    CyDmaChEnable(DMA_Count_Chan, 1);
+
+    // Start recording at the first sample of the probe
+    ProbeCapture_WriteTrigger(PROBE_VALUE);
+    UART_PutStringConst("Push SW1 to stop\r\n");
+
+    // Wait for the SW1 pushed, and the last record flushed
+    while (Pin_SW1_Read()) ;
+    CyDelay(10);
+
+    // Every record but the last is full
+    for (k = 0; k < RECORDS && count[k]; k++) {
+        if (value[k] != PROBE_VALUE) errors++;
+        if (k + 1 < RECORDS && count[k + 1] && count[k] != 255u) errors++;
+        samples += count[k];
+        records++;
+    }
+    sprintf(sbuf, "records=%lu samples=%lu check=%s\r\n",
+        records, samples, (errors || !records) ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;)
+    {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
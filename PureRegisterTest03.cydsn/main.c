@@ -0,0 +1,47 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+int main(void)
+{
+    uint8 i;
+    PR1_value a0, a1;
+    char sbuf[128];
+    
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    /* Place your initialization/startup code here (e.g. MyInst_Start()) */
+    UART_Start();
+    UART_PutString("\r\nHELLO WORLD\r\n");
+    sprintf(sbuf, "INIT A0=%08lX, A1=%08lX\r\n", (uint32)PR1_ReadA0(), (uint32)PR1_ReadA1());
+    UART_PutString(sbuf);
+    
+    // Every byte lane of the 32-bit registers is written
+    for (i = 0; i < 10; i++) {
+        a0 = (PR1_value)(i * 0x01010101u);
+        a1 = (PR1_value)((9-i) * 0x01010101u);
+        sprintf(sbuf, "WRITE A0=%08lX, A1=%08lX\r\n", (uint32)a0, (uint32)a1);
+        UART_PutString(sbuf);
+        PR1_WriteA0(a0);
+        PR1_WriteA1(a1);
+        sprintf(sbuf, "READ A0=%08lX, A1=%08lX\r\n", (uint32)PR1_ReadA0(), (uint32)PR1_ReadA1());
+        UART_PutString(sbuf);
+    }    
+
+    for(;;)
+    {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,55 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// The main-loop
+int main(void)
+{
+    uint32 k;
+    uint32 errors = 0;
+    uint8 mask;
+    uint8 flags;
+    char sbuf[64];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nSEMAPHORE TEST\r\n");
+
+    // Clear the flags left by the start up
+    (void)Semaphore_Take();
+
+    for (k = 0; k < 256u; k++) {
+        // Set the flags in two writes
+        mask = (uint8)k;
+        Semaphore_Set(mask & 0x0Fu);
+        Semaphore_Set(mask & 0xF0u);
+
+        // A read returns the flags and clears them
+        flags = Semaphore_Take();
+        if (flags != mask) errors++;
+        flags = Semaphore_Take();
+        if (flags != 0u) errors++;
+    }
+    sprintf(sbuf, "masks=%lu errors=%lu check=%s\r\n",
+        k, errors, errors ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;)
+    {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
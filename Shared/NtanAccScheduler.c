@@ -0,0 +1,236 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "NtanAccScheduler.h"
+
+// Lane state
+#define LANE_IDLE       (0u)    // Waiting for a job
+#define LANE_FEED       (1u)    // DMA is feeding the job
+#define LANE_DRAIN      (2u)    // Waiting for DONE
+
+typedef struct {
+    void        *input;
+    void        *accumulator;
+    void        *result;
+    reg8        *status;
+    uint8       doneMask;
+    uint8       width;
+    uint8       channel;
+    uint8       td;
+    uint8       state;
+    uint8       done;           // DONE seen in the sticky status
+    uint32      sum;            // Popped from the result FIFO
+    uint32      next;           // Address of the next piece
+    uint32      left;           // Bytes not fed yet
+    NtanAccScheduler_callback callback;
+    void        *context;
+} NtanAccScheduler_lane;
+
+typedef struct {
+    const void  *buffer;
+    uint16      items;
+    NtanAccScheduler_callback callback;
+    void        *context;
+} NtanAccScheduler_job;
+
+static NtanAccScheduler_lane NtanAccScheduler_lanes[NtanAccScheduler_MAX_LANES];
+static uint8 NtanAccScheduler_nLanes;
+static NtanAccScheduler_job NtanAccScheduler_queue[NtanAccScheduler_QUEUE_SIZE];
+static uint8 NtanAccScheduler_head;
+static uint8 NtanAccScheduler_count;
+static uint32 NtanAccScheduler_completed;
+
+void NtanAccScheduler_Start(void) {
+    NtanAccScheduler_nLanes = 0u;
+    NtanAccScheduler_head = 0u;
+    NtanAccScheduler_count = 0u;
+    NtanAccScheduler_completed = 0u;
+}
+
+// Add an Accumulator as a lane.
+// input, accumulator and result are the _INPUT_PTR,
+// _ACCUMULATOR_PTR and _RESULT_PTR of the instance and width is
+// its width in bytes.  status is the sticky status register with
+// DONE of the instance on doneMask.
+cystatus NtanAccScheduler_AddLane(void *input, void *accumulator,
+        void *result, uint8 width, uint8 dmaChannel, reg8 *status, uint8 doneMask) {
+    NtanAccScheduler_lane *lane;
+    if (NtanAccScheduler_nLanes >= NtanAccScheduler_MAX_LANES) {
+        return CYRET_INVALID_STATE;
+    }
+    if ((width != 1u && width != 2u && width != 4u)
+            || dmaChannel == CY_DMA_INVALID_CHANNEL) {
+        return CYRET_BAD_PARAM;
+    }
+    lane = &NtanAccScheduler_lanes[NtanAccScheduler_nLanes];
+    lane->td = CyDmaTdAllocate();
+    if (lane->td == CY_DMA_INVALID_TD) {
+        return CYRET_INVALID_STATE;
+    }
+    lane->input = input;
+    lane->accumulator = accumulator;
+    lane->result = result;
+    lane->status = status;
+    lane->doneMask = doneMask;
+    lane->width = width;
+    lane->channel = dmaChannel;
+    lane->state = LANE_IDLE;
+    CyDmaChSetInitialTd(dmaChannel, lane->td);
+    NtanAccScheduler_nLanes++;
+    return CYRET_SUCCESS;
+}
+
+// Queue a job of items words of the lane width.
+// The buffer must stay untouched until the callback.
+cystatus NtanAccScheduler_Submit(const void *buffer, uint16 items,
+        NtanAccScheduler_callback callback, void *context) {
+    NtanAccScheduler_job *job;
+    if (items == 0u) {
+        return CYRET_BAD_PARAM;
+    }
+    if (NtanAccScheduler_count >= NtanAccScheduler_QUEUE_SIZE) {
+        return CYRET_INVALID_STATE;
+    }
+    job = &NtanAccScheduler_queue[
+        (NtanAccScheduler_head + NtanAccScheduler_count) % NtanAccScheduler_QUEUE_SIZE];
+    job->buffer = buffer;
+    job->items = items;
+    job->callback = callback;
+    job->context = context;
+    NtanAccScheduler_count++;
+    return CYRET_SUCCESS;
+}
+
+// Feed the next piece of the job, a whole number of words
+static void NtanAccScheduler_Feed(NtanAccScheduler_lane *lane) {
+    uint16 bytes = NtanAccScheduler_TD_MAX - (NtanAccScheduler_TD_MAX % lane->width);
+    if (lane->left < bytes) {
+        bytes = (uint16)lane->left;
+    }
+    CyDmaTdSetConfiguration(lane->td, bytes, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+    CyDmaTdSetAddress(lane->td, LO16(lane->next), LO16((uint32)lane->input));
+    lane->next += bytes;
+    lane->left -= bytes;
+    lane->state = LANE_FEED;
+    lane->done = 0u;
+    CyDmaChEnable(lane->channel, 1u);
+}
+
+// Pop the sum pushed at DONE
+static uint32 NtanAccScheduler_ReadResult(const NtanAccScheduler_lane *lane) {
+    if (lane->width == 4u) {
+        return CY_GET_REG32(lane->result);
+    } else if (lane->width == 2u) {
+        return CY_GET_REG16(lane->result);
+    }
+    return CY_GET_REG8(lane->result);
+}
+
+// Read every status register once.  A read clears the sticky
+// bits of all the lanes on it, so they are kept in the lanes.
+static void NtanAccScheduler_ReadDone(void) {
+    uint8 i;
+    uint8 j;
+    for (i = 0u; i < NtanAccScheduler_nLanes; i++) {
+        reg8 *status = NtanAccScheduler_lanes[i].status;
+        uint8 value;
+        for (j = 0u; j < i; j++) {
+            if (NtanAccScheduler_lanes[j].status == status) {
+                break;
+            }
+        }
+        if (j < i) {
+            continue;
+        }
+        value = CY_GET_REG8(status);
+        for (j = i; j < NtanAccScheduler_nLanes; j++) {
+            NtanAccScheduler_lane *lane = &NtanAccScheduler_lanes[j];
+            if (lane->status == status && (value & lane->doneMask)) {
+                lane->done = 1u;
+            }
+        }
+    }
+}
+
+static void NtanAccScheduler_ClearSum(const NtanAccScheduler_lane *lane) {
+    if (lane->width == 4u) {
+        CY_SET_REG32(lane->accumulator, 0u);
+    } else if (lane->width == 2u) {
+        CY_SET_REG16(lane->accumulator, 0u);
+    } else {
+        CY_SET_REG8(lane->accumulator, 0u);
+    }
+}
+
+// Advance every lane once.
+// The last word is still in the FIFO for an ACC clock after the
+// DMA ends, so a piece is complete on DONE of the lane, not on the
+// end of the DMA.  The next piece is fed only after that.
+void NtanAccScheduler_Poll(void) {
+    uint8 i;
+    uint8 state;
+    NtanAccScheduler_ReadDone();
+    for (i = 0u; i < NtanAccScheduler_nLanes; i++) {
+        NtanAccScheduler_lane *lane = &NtanAccScheduler_lanes[i];
+        if (lane->state == LANE_FEED) {
+            CyDmaChStatus(lane->channel, NULL, &state);
+            if (state & CY_DMA_STATUS_CHAIN_ACTIVE) {
+                continue;
+            }
+            lane->state = LANE_DRAIN;
+        }
+        if (lane->state == LANE_DRAIN) {
+            if (!lane->done) {
+                continue;
+            }
+            lane->sum = NtanAccScheduler_ReadResult(lane);
+            if (lane->left) {
+                NtanAccScheduler_Feed(lane);
+                continue;
+            }
+            lane->state = LANE_IDLE;
+            NtanAccScheduler_completed++;
+            if (lane->callback) {
+                lane->callback(lane->sum, lane->context);
+            }
+        }
+        if (lane->state == LANE_IDLE && NtanAccScheduler_count) {
+            NtanAccScheduler_job *job = &NtanAccScheduler_queue[NtanAccScheduler_head];
+            NtanAccScheduler_head = (NtanAccScheduler_head + 1u) % NtanAccScheduler_QUEUE_SIZE;
+            NtanAccScheduler_count--;
+            lane->next = (uint32)job->buffer;
+            lane->left = (uint32)job->items * lane->width;
+            lane->callback = job->callback;
+            lane->context = job->context;
+            NtanAccScheduler_ClearSum(lane);
+            NtanAccScheduler_Feed(lane);
+        }
+    }
+}
+
+// Jobs queued or running
+uint8 NtanAccScheduler_Pending(void) {
+    uint8 i;
+    uint8 n = NtanAccScheduler_count;
+    for (i = 0u; i < NtanAccScheduler_nLanes; i++) {
+        if (NtanAccScheduler_lanes[i].state != LANE_IDLE) {
+            n++;
+        }
+    }
+    return n;
+}
+
+uint32 NtanAccScheduler_Completed(void) {
+    return NtanAccScheduler_completed;
+}
+
+/* [] END OF FILE */
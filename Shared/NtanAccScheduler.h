@@ -0,0 +1,68 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANACCSCHEDULER_H)
+#define NTANACCSCHEDULER_H
+
+#include <cytypes.h>
+#include <CyDmac.h>
+
+// Job scheduler over several Accumulator8/16/32 instances
+//
+// A lane is one Accumulator with its own DMA channel.  A job
+// is summed in one lane, so jobs run in parallel on as many
+// lanes as there are.  Submit() and Poll() are called from the
+// main loop, and the callback runs in Poll().
+//
+// The DMA channel of a lane moves WIDTH bytes per burst with
+// a request per burst, like the Accumulator test projects.
+// Its upper addresses are HI16(CYDEV_SRAM_BASE) for the job
+// buffers and HI16(CYDEV_PERIPH_BASE) for the Accumulator.
+//
+// Every lane has ResultFifo=1, and its DONE is routed to a bit of
+// a status register in the sticky mode, so a piece of a job is
+// complete once the DMA has ended and the bit has been set.  The
+// sum is popped from the result FIFO.  The ACC clock must be slow
+// enough for the DMA to keep F0 from running empty within a piece,
+// or DONE rises early.  The host benchmark needs BUS_CLK/16 for
+// up to two lanes and BUS_CLK/24 for four lanes.
+//
+// This is a plain source, not a component.  Add this file and
+// NtanAccScheduler.c to the project, and define the sizes below
+// in the compiler options to change them.
+
+#if !defined(NtanAccScheduler_MAX_LANES)
+#define NtanAccScheduler_MAX_LANES  (4u)
+#endif
+#if !defined(NtanAccScheduler_QUEUE_SIZE)
+#define NtanAccScheduler_QUEUE_SIZE (8u)
+#endif
+
+// Largest TD transfer, a longer job is fed in pieces
+#define NtanAccScheduler_TD_MAX     (4095u)
+
+typedef void (*NtanAccScheduler_callback)(uint32 sum, void *context);
+
+//**************************************************************
+//  Function Prototypes
+//**************************************************************
+extern void NtanAccScheduler_Start(void);
+extern cystatus NtanAccScheduler_AddLane(void *input, void *accumulator,
+    void *result, uint8 width, uint8 dmaChannel, reg8 *status, uint8 doneMask);
+extern cystatus NtanAccScheduler_Submit(const void *buffer, uint16 items,
+    NtanAccScheduler_callback callback, void *context);
+extern void NtanAccScheduler_Poll(void);
+extern uint8 NtanAccScheduler_Pending(void);
+extern uint32 NtanAccScheduler_Completed(void);
+
+#endif  // NTANACCSCHEDULER_H
+/* [] END OF FILE */
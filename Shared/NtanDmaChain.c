@@ -0,0 +1,175 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "NtanDmaChain.h"
+
+static uint8 NtanDmaChain_channel = CY_DMA_INVALID_CHANNEL;
+static uint8 NtanDmaChain_td[NtanDmaChain_MAX_TDS];
+static uint8 NtanDmaChain_segmentOf[NtanDmaChain_MAX_TDS];
+static uint8 NtanDmaChain_nTds;
+
+// TDs needed by a segment
+static uint32 NtanDmaChain_Pieces(uint32 bytes) {
+    return (bytes + NtanDmaChain_TD_SPLIT - 1u) / NtanDmaChain_TD_SPLIT;
+}
+
+// Build a chain on a channel, replacing the previous one.
+// The upper addresses of the channel are set from the segments.
+// TERMOUT flags of a split segment are kept on its last TD only.
+cystatus NtanDmaChain_Build(uint8 channel,
+        const NtanDmaChain_segment segments[], uint8 count, uint8 mode) {
+    uint8 s, n, i;
+    uint32 total = 0u;
+    uint16 upperSrc, upperDst;
+
+    if (channel == CY_DMA_INVALID_CHANNEL || count == 0u) {
+        return CYRET_BAD_PARAM;
+    }
+    upperSrc = (uint16)HI16((uint32)segments[0].src);
+    upperDst = (uint16)HI16((uint32)segments[0].dst);
+    for (s = 0u; s < count; s++) {
+        uint32 src = (uint32)segments[s].src;
+        uint32 dst = (uint32)segments[s].dst;
+        uint32 last = segments[s].bytes - 1u;
+        if (segments[s].bytes == 0u) {
+            return CYRET_BAD_PARAM;
+        }
+        // The channel has one pair of upper addresses
+        if (HI16(src) != upperSrc || HI16(dst) != upperDst) {
+            return CYRET_BAD_PARAM;
+        }
+        // A TD does not carry over into the next 64KB
+        if ((segments[s].config & CY_DMA_TD_INC_SRC_ADR)
+                && HI16(src + last) != upperSrc) {
+            return CYRET_BAD_PARAM;
+        }
+        if ((segments[s].config & CY_DMA_TD_INC_DST_ADR)
+                && HI16(dst + last) != upperDst) {
+            return CYRET_BAD_PARAM;
+        }
+        total += NtanDmaChain_Pieces(segments[s].bytes);
+    }
+    if (total > NtanDmaChain_MAX_TDS) {
+        return CYRET_BAD_PARAM;
+    }
+
+    NtanDmaChain_Free();
+    for (n = 0u; n < total; n++) {
+        NtanDmaChain_td[n] = CyDmaTdAllocate();
+        if (NtanDmaChain_td[n] == CY_DMA_INVALID_TD) {
+            NtanDmaChain_nTds = n;
+            NtanDmaChain_Free();
+            return CYRET_INVALID_STATE;
+        }
+    }
+    NtanDmaChain_nTds = (uint8)total;
+    NtanDmaChain_channel = channel;
+
+    n = 0u;
+    for (s = 0u; s < count; s++) {
+        uint32 src = (uint32)segments[s].src;
+        uint32 dst = (uint32)segments[s].dst;
+        uint32 left = segments[s].bytes;
+        uint8 config = segments[s].config;
+        uint8 pieces = (uint8)NtanDmaChain_Pieces(left);
+        for (i = 0u; i < pieces; i++, n++) {
+            uint16 bytes = (left > NtanDmaChain_TD_SPLIT)
+                ? NtanDmaChain_TD_SPLIT : (uint16)left;
+            uint8 next;
+            if (n + 1u < total) {
+                next = NtanDmaChain_td[n + 1u];
+            } else if (mode == NtanDmaChain_LOOP) {
+                next = NtanDmaChain_td[0];
+            } else {
+                next = CY_DMA_DISABLE_TD;
+            }
+            CyDmaTdSetConfiguration(NtanDmaChain_td[n], bytes, next,
+                (i + 1u < pieces)
+                    ? (config & ~(CY_DMA_TD_TERMOUT0_EN | CY_DMA_TD_TERMOUT1_EN))
+                    : config);
+            CyDmaTdSetAddress(NtanDmaChain_td[n], LO16(src), LO16(dst));
+            NtanDmaChain_segmentOf[n] = s;
+            if (config & CY_DMA_TD_INC_SRC_ADR) {
+                src += bytes;
+            }
+            if (config & CY_DMA_TD_INC_DST_ADR) {
+                dst += bytes;
+            }
+            left -= bytes;
+        }
+    }
+    CyDmaChSetExtendedAddress(channel, upperSrc, upperDst);
+    CyDmaChSetInitialTd(channel, NtanDmaChain_td[0]);
+    return CYRET_SUCCESS;
+}
+
+// Two buffers sent in turn for ever.
+// Add CY_DMA_TD_TERMOUT0_EN to config for an interrupt at the end
+// of each buffer, and refill the one not in ActiveSegment().
+cystatus NtanDmaChain_PingPong(uint8 channel,
+        const volatile void *buffer0, const volatile void *buffer1, uint16 bytes,
+        volatile void *dst, uint8 config) {
+    NtanDmaChain_segment segments[2];
+    segments[0].src = buffer0;
+    segments[0].dst = dst;
+    segments[0].bytes = bytes;
+    segments[0].config = config;
+    segments[1] = segments[0];
+    segments[1].src = buffer1;
+    return NtanDmaChain_Build(channel, segments, 2u, NtanDmaChain_LOOP);
+}
+
+// The TDs are preserved so that a loop can run again
+void NtanDmaChain_Start(void) {
+    if (NtanDmaChain_nTds) {
+        CyDmaChEnable(NtanDmaChain_channel, 1u);
+    }
+}
+
+void NtanDmaChain_Stop(void) {
+    if (NtanDmaChain_nTds) {
+        CyDmaChDisable(NtanDmaChain_channel);
+    }
+}
+
+void NtanDmaChain_Free(void) {
+    uint8 n;
+    NtanDmaChain_Stop();
+    for (n = 0u; n < NtanDmaChain_nTds; n++) {
+        CyDmaTdFree(NtanDmaChain_td[n]);
+    }
+    NtanDmaChain_nTds = 0u;
+}
+
+// Segment of the TD in progress, 0xFF when the chain is stopped
+uint8 NtanDmaChain_ActiveSegment(void) {
+    uint8 td, state, n;
+    if (NtanDmaChain_nTds == 0u) {
+        return 0xFFu;
+    }
+    CyDmaChStatus(NtanDmaChain_channel, &td, &state);
+    if (!(state & CY_DMA_STATUS_CHAIN_ACTIVE)) {
+        return 0xFFu;
+    }
+    for (n = 0u; n < NtanDmaChain_nTds; n++) {
+        if (NtanDmaChain_td[n] == td) {
+            return NtanDmaChain_segmentOf[n];
+        }
+    }
+    return 0xFFu;
+}
+
+uint8 NtanDmaChain_TdCount(void) {
+    return NtanDmaChain_nTds;
+}
+
+/* [] END OF FILE */
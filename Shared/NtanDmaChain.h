@@ -0,0 +1,68 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANDMACHAIN_H)
+#define NTANDMACHAIN_H
+
+#include <cytypes.h>
+#include <CyDmac.h>
+
+// TD chain builder for one DMA channel
+//
+// A chain is described as a list of segments.  A segment longer
+// than a TD can move is split into several TDs.  The chain ends
+// by disabling the channel, or loops back to the first segment.
+// The channel is initialized by its own DmaInitialize(), and
+// Build() sets its upper source and destination addresses from the
+// first segment.  Every segment must lie in those 64KB windows,
+// and a segment must not cross a window in an address it
+// increments, or Build() returns CYRET_BAD_PARAM.
+//
+// This is a plain source, not a component, and it keeps one chain.
+// Add this file and NtanDmaChain.c to the project, and define
+// NtanDmaChain_MAX_TDS in the compiler options to change the size
+// of the TD table.
+
+#if !defined(NtanDmaChain_MAX_TDS)
+#define NtanDmaChain_MAX_TDS    (16u)
+#endif
+
+// Bytes per TD of a split segment, a multiple of every spoke width
+#define NtanDmaChain_TD_SPLIT   (4092u)
+
+// Chain mode
+#define NtanDmaChain_ONCE       (0u)    // Disable the channel at the end
+#define NtanDmaChain_LOOP       (1u)    // Restart from the first segment
+
+typedef struct {
+    const volatile void *src;
+    volatile void *dst;
+    uint32      bytes;
+    uint8       config;             // CY_DMA_TD_* flags
+} NtanDmaChain_segment;
+
+//**************************************************************
+//  Function Prototypes
+//**************************************************************
+extern cystatus NtanDmaChain_Build(uint8 channel,
+    const NtanDmaChain_segment segments[], uint8 count, uint8 mode);
+extern cystatus NtanDmaChain_PingPong(uint8 channel,
+    const volatile void *buffer0, const volatile void *buffer1, uint16 bytes,
+    volatile void *dst, uint8 config);
+extern void NtanDmaChain_Start(void);
+extern void NtanDmaChain_Stop(void);
+extern void NtanDmaChain_Free(void);
+extern uint8 NtanDmaChain_ActiveSegment(void);
+extern uint8 NtanDmaChain_TdCount(void);
+
+#endif  // NTANDMACHAIN_H
+/* [] END OF FILE */
@@ -0,0 +1,39 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "NtanSleepWait.h"
+
+static uint32 NtanSleepWait_wakeups = 0u;
+
+// Sleep until an interrupt sets *flag, then clear it.
+// The flag is checked with the interrupts masked.  A pending
+// interrupt ends WFI even while masked, so one raised after the
+// check is not missed, and it is taken when they are unmasked.
+void NtanSleepWait_WaitFlag(volatile uint8 *flag) {
+    uint8 intState = CyEnterCriticalSection();
+    while (!*flag) {
+        CY_PM_WFI;
+        NtanSleepWait_wakeups++;
+        CyExitCriticalSection(intState);
+        intState = CyEnterCriticalSection();
+    }
+    *flag = 0u;
+    CyExitCriticalSection(intState);
+}
+
+// Times the CPU woke up, more than the waits when other
+// interrupts come during them
+uint32 NtanSleepWait_Wakeups(void) {
+    return NtanSleepWait_wakeups;
+}
+
+/* [] END OF FILE */
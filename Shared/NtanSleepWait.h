@@ -0,0 +1,41 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#if !defined(NTANSLEEPWAIT_H)
+#define NTANSLEEPWAIT_H
+
+#include <cytypes.h>
+#include <CyLib.h>
+#include <cyPm.h>
+
+// Wait for a completion interrupt with the CPU asleep
+//
+// The CPU clock is stopped by WFI while the UDBs and the DMA
+// keep running, so a stream into an Accumulator or out of an
+// NtanUartTx goes on during the wait.  CyPmSleep() is not used
+// because it stops the clocks of the UDBs and the DMA as well.
+//
+// The flag is set by the completion interrupt, like int_Ready
+// on the falling edge of BUSY, or the nrq of the DMA channel.
+// Call with the interrupts enabled.
+//
+// This is a plain source, not a component.  Add this file and
+// NtanSleepWait.c to the project.
+
+//**************************************************************
+//  Function Prototypes
+//**************************************************************
+extern void NtanSleepWait_WaitFlag(volatile uint8 *flag);
+extern uint32 NtanSleepWait_Wakeups(void);
+
+#endif  // NTANSLEEPWAIT_H
+/* [] END OF FILE */
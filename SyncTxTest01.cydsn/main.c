@@ -0,0 +1,72 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// Data packet to be sent
+// A ramp of every byte value is easy to check with a logic analyzer
+#define PACKET_SIZE (256u)
+uint8 packet[PACKET_SIZE];
+
+// Defines for DMA_SyncTx
+#define DMA_SyncTx_BYTES_PER_BURST 1
+#define DMA_SyncTx_REQUEST_PER_BURST 1
+#define DMA_SyncTx_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_SyncTx_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA_SyncTx
+uint8 DMA_SyncTx_Chan;
+uint8 DMA_SyncTx_TD[1];
+
+// The main-loop
+int main(void)
+{
+    uint32 round = 0;
+    uint32 k;
+    uint8 dmaState;
+    char sbuf[64];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nSYNCTX TEST\r\n");
+
+    // Initialize the packet[]
+    for (k = 0; k < PACKET_SIZE; k++) {
+        packet[k] = (uint8)k;
+    }
+
+    // DMA Configuration for DMA_SyncTx
+    DMA_SyncTx_Chan = DMA_SyncTx_DmaInitialize(
+        DMA_SyncTx_BYTES_PER_BURST, DMA_SyncTx_REQUEST_PER_BURST,
+        HI16(DMA_SyncTx_SRC_BASE), HI16(DMA_SyncTx_DST_BASE));
+    DMA_SyncTx_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(DMA_SyncTx_TD[0], sizeof packet, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+    CyDmaTdSetAddress(DMA_SyncTx_TD[0], LO16((uint32)packet), LO16((uint32)SyncTx_INPUT_PTR));
+
+    for(;;)
+    {
+        // Send a packet until exhausted
+        CyDmaChSetInitialTd(DMA_SyncTx_Chan, DMA_SyncTx_TD[0]);
+        CyDmaChEnable(DMA_SyncTx_Chan, 1);
+        do {
+            CyDmaChStatus(DMA_SyncTx_Chan, NULL, &dmaState);
+        } while (dmaState & CY_DMA_STATUS_CHAIN_ACTIVE);
+
+        sprintf(sbuf, "round=%lu\r\n", round++);
+        UART_PutString(sbuf);
+        CyDelay(100);
+    }
+}
+
+/* [] END OF FILE */
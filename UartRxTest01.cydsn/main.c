@@ -0,0 +1,101 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// Data packet to be sent and received
+const char phrase[] = "The quick brown fox jumps over the lazy dog. ";
+#define PACKET_SIZE (sizeof phrase - 1)
+uint8 received[PACKET_SIZE];
+
+// Defines for DMA_UartTx
+#define DMA_UartTx_BYTES_PER_BURST 1
+#define DMA_UartTx_REQUEST_PER_BURST 1
+#define DMA_UartTx_SRC_BASE (CYDEV_FLASH_BASE)
+#define DMA_UartTx_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Defines for DMA_UartRx
+#define DMA_UartRx_BYTES_PER_BURST 1
+#define DMA_UartRx_REQUEST_PER_BURST 1
+#define DMA_UartRx_SRC_BASE (CYDEV_PERIPH_BASE)
+#define DMA_UartRx_DST_BASE (CYDEV_SRAM_BASE)
+
+// Variable declarations for DMA_UartTx and DMA_UartRx
+uint8 DMA_UartTx_Chan;
+uint8 DMA_UartTx_TD[1];
+uint8 DMA_UartRx_Chan;
+uint8 DMA_UartRx_TD[1];
+
+// The main-loop
+int main(void)
+{
+    uint32 round = 0;
+    uint32 k, errors;
+    uint8 dmaState;
+    uint8 status;
+    char sbuf[64];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nUARTRX TEST\r\n");
+
+    // DMA Configuration for DMA_UartTx
+    DMA_UartTx_Chan = DMA_UartTx_DmaInitialize(
+        DMA_UartTx_BYTES_PER_BURST, DMA_UartTx_REQUEST_PER_BURST,
+        HI16(DMA_UartTx_SRC_BASE), HI16(DMA_UartTx_DST_BASE));
+    DMA_UartTx_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(DMA_UartTx_TD[0], PACKET_SIZE, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+    CyDmaTdSetAddress(DMA_UartTx_TD[0], LO16((uint32)phrase), LO16((uint32)UartTx_INPUT_PTR));
+
+    // DMA Configuration for DMA_UartRx
+    DMA_UartRx_Chan = DMA_UartRx_DmaInitialize(
+        DMA_UartRx_BYTES_PER_BURST, DMA_UartRx_REQUEST_PER_BURST,
+        HI16(DMA_UartRx_SRC_BASE), HI16(DMA_UartRx_DST_BASE));
+    DMA_UartRx_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(DMA_UartRx_TD[0], PACKET_SIZE, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_DST_ADR);
+    CyDmaTdSetAddress(DMA_UartRx_TD[0], LO16((uint32)UartRx_OUTPUT_PTR), LO16((uint32)received));
+
+    // Clear the sticky errors left by the start up
+    (void)UartRx_ReadStatus();
+
+    for(;;)
+    {
+        for (k = 0; k < PACKET_SIZE; k++) received[k] = 0;
+
+        // Arm the receiver before the transmitter
+        CyDmaChSetInitialTd(DMA_UartRx_Chan, DMA_UartRx_TD[0]);
+        CyDmaChEnable(DMA_UartRx_Chan, 1);
+        CyDmaChSetInitialTd(DMA_UartTx_Chan, DMA_UartTx_TD[0]);
+        CyDmaChEnable(DMA_UartTx_Chan, 1);
+
+        // Wait for the whole packet received
+        do {
+            CyDmaChStatus(DMA_UartRx_Chan, NULL, &dmaState);
+        } while (dmaState & CY_DMA_STATUS_CHAIN_ACTIVE);
+
+        errors = 0;
+        for (k = 0; k < PACKET_SIZE; k++) {
+            if (received[k] != (uint8)phrase[k]) errors++;
+        }
+        status = UartRx_ReadStatus();
+        sprintf(sbuf, "round=%lu errors=%lu ferr=%u ovr=%u check=%s\r\n",
+            round++, errors,
+            (status & UartRx_STS_FERR) ? 1u : 0u, (status & UartRx_STS_OVR) ? 1u : 0u,
+            (errors || (status & (UartRx_STS_FERR | UartRx_STS_OVR))) ? "NG" : "ok");
+        UART_PutString(sbuf);
+        CyDelay(500);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include "project.h"
+#include <stdio.h>
+
+// Data packets to be sent, one for each channel
+const char phrase0[] = "0: The quick brown fox jumps over the lazy dog.\r\n";
+const char phrase1[] = "1: Pack my box with five dozen liquor jugs.\r\n";
+const char phrase2[] = "2: How vexingly quick daft zebras jump!\r\n";
+const char phrase3[] = "3: Sphinx of black quartz, judge my vow.\r\n";
+
+const char *const phrase[UartTx4_CHANNELS] = {phrase0, phrase1, phrase2, phrase3};
+const uint16 phraseBytes[UartTx4_CHANNELS] = {
+    sizeof phrase0 - 1, sizeof phrase1 - 1, sizeof phrase2 - 1, sizeof phrase3 - 1
+};
+
+// Defines for DMA_Tx0 to DMA_Tx3
+#define DMA_Tx_BYTES_PER_BURST 1
+#define DMA_Tx_REQUEST_PER_BURST 1
+#define DMA_Tx_SRC_BASE (CYDEV_FLASH_BASE)
+#define DMA_Tx_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA_Tx0 to DMA_Tx3
+uint8 DMA_Tx_Chan[UartTx4_CHANNELS];
+uint8 DMA_Tx_TD[UartTx4_CHANNELS];
+
+// The main-loop
+int main(void)
+{
+    uint32 round = 0;
+    uint8 ch;
+    uint8 active;
+    char sbuf[64];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nUARTTX4 TEST\r\n");
+
+    // DMA Configuration for DMA_Tx0 to DMA_Tx3
+    DMA_Tx_Chan[0] = DMA_Tx0_DmaInitialize(
+        DMA_Tx_BYTES_PER_BURST, DMA_Tx_REQUEST_PER_BURST,
+        HI16(DMA_Tx_SRC_BASE), HI16(DMA_Tx_DST_BASE));
+    DMA_Tx_Chan[1] = DMA_Tx1_DmaInitialize(
+        DMA_Tx_BYTES_PER_BURST, DMA_Tx_REQUEST_PER_BURST,
+        HI16(DMA_Tx_SRC_BASE), HI16(DMA_Tx_DST_BASE));
+    DMA_Tx_Chan[2] = DMA_Tx2_DmaInitialize(
+        DMA_Tx_BYTES_PER_BURST, DMA_Tx_REQUEST_PER_BURST,
+        HI16(DMA_Tx_SRC_BASE), HI16(DMA_Tx_DST_BASE));
+    DMA_Tx_Chan[3] = DMA_Tx3_DmaInitialize(
+        DMA_Tx_BYTES_PER_BURST, DMA_Tx_REQUEST_PER_BURST,
+        HI16(DMA_Tx_SRC_BASE), HI16(DMA_Tx_DST_BASE));
+    for (ch = 0; ch < UartTx4_CHANNELS; ch++) {
+        DMA_Tx_TD[ch] = CyDmaTdAllocate();
+        CyDmaTdSetConfiguration(DMA_Tx_TD[ch], phraseBytes[ch], CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+        CyDmaTdSetAddress(DMA_Tx_TD[ch], LO16((uint32)phrase[ch]), LO16((uint32)UartTx4_InputPtr(ch)));
+    }
+
+    for(;;)
+    {
+        // Send a phrase on every channel at once
+        for (ch = 0; ch < UartTx4_CHANNELS; ch++) {
+            CyDmaChSetInitialTd(DMA_Tx_Chan[ch], DMA_Tx_TD[ch]);
+            CyDmaChEnable(DMA_Tx_Chan[ch], 1);
+        }
+
+        // Wait for all channels exhausted
+        do {
+            active = 0;
+            for (ch = 0; ch < UartTx4_CHANNELS; ch++) {
+                uint8 dmaState;
+                CyDmaChStatus(DMA_Tx_Chan[ch], NULL, &dmaState);
+                if (dmaState & CY_DMA_STATUS_CHAIN_ACTIVE) active++;
+            }
+        } while (active);
+
+        sprintf(sbuf, "round=%lu\r\n", round++);
+        UART_PutString(sbuf);
+        CyDelay(500);
+    }
+}
+
+/* [] END OF FILE */
@@ -19,8 +19,11 @@
 uint32 state = ST_IDLE;
 
 // Data packet to be sent
+// The phrase[] is repeated from flash as the segments of a packet
 const char phrase[] = "The quick brown fox jumps over the lazy dog. ";
-uint8 packet[256];
+#define PACKET_SIZE (256u)
+UartTx_segment packet[UartTx_MAX_SEGMENTS];
+uint8 packetSegments;
 
 // Defines for DMA_UartTx
 #define DMA_UartTx_BYTES_PER_BURST 1
@@ -29,9 +32,7 @@ uint8 packet[256];
 #define DMA_UartTx_DST_BASE (CYDEV_PERIPH_BASE)
 
 // Variable declarations for DMA_UartTx
-// Move these variable declarations to the top of the function
 uint8 DMA_UartTx_Chan;
-uint8 DMA_UartTx_TD[1];
 
 // The main-loop
 int main(void)
@@ -45,18 +46,14 @@ int main(void)
     DMA_UartTx_Chan = DMA_UartTx_DmaInitialize(
         DMA_UartTx_BYTES_PER_BURST, DMA_UartTx_REQUEST_PER_BURST, 
         HI16(DMA_UartTx_SRC_BASE), HI16(DMA_UartTx_DST_BASE));
-    DMA_UartTx_TD[0] = CyDmaTdAllocate();
-    CyDmaTdSetConfiguration(DMA_UartTx_TD[0], sizeof packet, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
-    CyDmaTdSetAddress(DMA_UartTx_TD[0], LO16((uint32)packet), LO16((uint32)UartTx_INPUT_PTR));
-    CyDmaChSetInitialTd(DMA_UartTx_Chan, DMA_UartTx_TD[0]);
 
     // Initialize the packet[]
-    // Copy the phrase[] into packet[] as possible
-    for (uint32 k = 0; k < sizeof packet; ) {
-        for (uint32 i = 0; i < sizeof phrase; i++) {
-            packet[k++] = phrase[i];
-            if (k >= sizeof packet) break;
-        }
+    // Refer the phrase[] as many times as possible
+    for (uint32 k = 0; k < PACKET_SIZE; packetSegments++) {
+        packet[packetSegments].data = phrase;
+        packet[packetSegments].bytes = (PACKET_SIZE - k < sizeof phrase)
+            ? (uint16)(PACKET_SIZE - k) : (uint16)sizeof phrase;
+        k += packet[packetSegments].bytes;
     }
 
     for(;;)
@@ -67,18 +64,19 @@ int main(void)
                 // Wait for the SW1 pushed
                 if (!Pin_SW1_Read()) {
                     // SW1 pushed
-                    CyDmaChEnable(DMA_UartTx_Chan, 1);
-                    state = ST_SEND;
+                    if (UartTx_Send(DMA_UartTx_Chan, packet, packetSegments) == CYRET_SUCCESS) {
+                        state = ST_SEND;
+                    } else {
+                        // Rejected packet, wait for the SW1 released
+                        state = ST_WAIT;
+                    }
                 }
                 break;
             case ST_SEND:
                 // Send a packet until exhausted
-                {
-                    uint8 dmaState;
-                    CyDmaChStatus(DMA_UartTx_Chan, NULL, &dmaState);
-                    if (!(dmaState & CY_DMA_STATUS_CHAIN_ACTIVE)) {
-                        state = ST_WAIT;
-                    }
+                UartTx_Poll();
+                if (!UartTx_Busy()) {
+                    state = ST_WAIT;
                 }
                 break;
             case ST_WAIT:
@@ -0,0 +1,75 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Host replacement of CyDmac.h
+//
+// TD addresses are full host pointers, so the address
+// arguments are uint32 instead of uint16.
+
+#if !defined(CY_HOST_CYDMAC_H)
+#define CY_HOST_CYDMAC_H
+
+#include "cytypes.h"
+
+#define CY_DMA_NUMBEROF_TDS         (128u)
+#define CY_DMA_NUMBEROF_CHANNELS    (24u)
+
+#define CY_DMA_INVALID_CHANNEL      (0xFFu)
+#define CY_DMA_INVALID_TD           (0xFFu)
+#define CY_DMA_END_CHAIN_TD         (0xFFu)
+#define CY_DMA_DISABLE_TD           (0xFEu)
+
+// TD configuration
+#define CY_DMA_TD_SWAP_EN           (0x80u)
+#define CY_DMA_TD_SWAP_SIZE4        (0x40u)
+#define CY_DMA_TD_AUTO_EXEC_NEXT    (0x20u)
+#define CY_DMA_TD_TERMIN_EN         (0x10u)
+#define CY_DMA_TD_TERMOUT1_EN       (0x08u)
+#define CY_DMA_TD_TERMOUT0_EN       (0x04u)
+#define CY_DMA_TD_INC_DST_ADR       (0x02u)
+#define CY_DMA_TD_INC_SRC_ADR       (0x01u)
+
+// Channel status
+#define CY_DMA_STATUS_CHAIN_ACTIVE  (0x01u)
+#define CY_DMA_STATUS_TD_ACTIVE     (0x02u)
+
+// Software request
+#define CY_DMA_CPU_REQ              (0x01u)
+#define CY_DMA_CPU_TERM_TD          (0x02u)
+#define CY_DMA_CPU_TERM_CHAIN       (0x04u)
+
+extern uint8 CyDmaChAlloc(void);
+extern cystatus CyDmaChFree(uint8 chHandle);
+extern cystatus CyDmaChEnable(uint8 chHandle, uint8 preserveTds);
+extern cystatus CyDmaChDisable(uint8 chHandle);
+extern cystatus CyDmaClearPendingDrq(uint8 chHandle);
+extern cystatus CyDmaChPriority(uint8 chHandle, uint8 priority);
+extern cystatus CyDmaChSetInitialTd(uint8 chHandle, uint8 startTd);
+extern cystatus CyDmaChSetRequest(uint8 chHandle, uint8 request);
+extern cystatus CyDmaChGetRequest(uint8 chHandle);
+extern cystatus CyDmaChStatus(uint8 chHandle, uint8 *currentTd, uint8 *state);
+extern cystatus CyDmaChSetConfiguration(uint8 chHandle, uint8 burstCount,
+    uint8 requestPerBurst, uint8 tdDone0, uint8 tdDone1, uint8 tdStop);
+extern cystatus CyDmaChSetExtendedAddress(uint8 chHandle, uint16 source, uint16 destination);
+
+extern uint8 CyDmaTdAllocate(void);
+extern void CyDmaTdFree(uint8 tdHandle);
+extern uint8 CyDmaTdFreeCount(void);
+extern cystatus CyDmaTdSetConfiguration(uint8 tdHandle, uint16 transferCount,
+    uint8 nextTd, uint8 configuration);
+extern cystatus CyDmaTdGetConfiguration(uint8 tdHandle, uint16 *transferCount,
+    uint8 *nextTd, uint8 *configuration);
+extern cystatus CyDmaTdSetAddress(uint8 tdHandle, uint32 source, uint32 destination);
+extern cystatus CyDmaTdGetAddress(uint8 tdHandle, uint32 *source, uint32 *destination);
+
+#endif  // CY_HOST_CYDMAC_H
+/* [] END OF FILE */
@@ -0,0 +1,26 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Host replacement of CyLib.h
+
+#if !defined(CY_HOST_CYLIB_H)
+#define CY_HOST_CYLIB_H
+
+#include "cytypes.h"
+
+// The state returned is the global interrupt enable
+extern uint8 Host_IntDisable(void);
+#define CyEnterCriticalSection()        Host_IntDisable()
+#define CyExitCriticalSection(savedIntrStatus) Host_IntEnable(savedIntrStatus)
+
+#endif  // CY_HOST_CYLIB_H
+/* [] END OF FILE */
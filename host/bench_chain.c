@@ -0,0 +1,171 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Chain benchmark of NtanDmaChain
+//
+// BENCH_RUNS runs of three segments are summed by ACC fed by DMA.
+// The middle segment is longer than a TD and is split into two.
+// The chain is built once and started again for every run, and
+// the end of a run is waited for on the int_Ready flag.
+//
+//   cycles/item  elapsed cycles per item
+//   segments     segments seen by ActiveSegment() in the last run
+//   params       Build() calls with a bad segment list refused
+//
+// Sources: Shared/NtanDmaChain.c
+// Instances: ACC (Accumulator16), DMA on dreq, int_Ready on the
+// falling edge of BUSY, and UART.
+
+#include "project.h"
+#include "NtanDmaChain.h"
+#include <stdio.h>
+
+#if !defined(BENCH_RUNS)
+#define BENCH_RUNS      (4u)
+#endif
+
+// Words of each segment
+#define SEG0_ITEMS      (300u)
+#define SEG1_ITEMS      (3000u)
+#define SEG2_ITEMS      (700u)
+#define BENCH_ITEMS     (SEG0_ITEMS + SEG1_ITEMS + SEG2_ITEMS)
+
+// Cortex-M3 DWT cycle counter
+#if !defined(DWT_CYCCNT_PTR)
+#define DEMCR_PTR       ((reg32 *) 0xE000EDFCu)
+#define DWT_CTRL_PTR    ((reg32 *) 0xE0001000u)
+#define DWT_CYCCNT_PTR  ((reg32 *) 0xE0001004u)
+#endif
+#define DEMCR_TRCENA        (0x01000000u)
+#define DWT_CTRL_CYCCNTENA  (0x00000001u)
+#define Cycles()        CY_GET_REG32(DWT_CYCCNT_PTR)
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST 2
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA
+uint8 DMA_Chan;
+
+// Data set and its sum
+uint16 seg0[SEG0_ITEMS];
+uint16 seg1[SEG1_ITEMS];
+uint16 seg2[SEG2_ITEMS];
+uint16 expected;
+
+// Accumulator Ready Detection
+volatile uint8 int_Ready_Flag = 0;
+
+CY_ISR(int_Ready_isr) {
+    int_Ready_Flag = 1;
+}
+
+int main(void) {
+    NtanDmaChain_segment segments[3];
+    NtanDmaChain_segment bad;
+    uint32 i, j;
+    uint32 t0, elapsed, perItem;
+    uint8 seen, active, params = 0;
+    uint8 errors = 0;
+    char sbuf[128];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nCHAIN BENCHMARK\r\n");
+
+    // Start the cycle counter
+    CY_SET_REG32(DEMCR_PTR, CY_GET_REG32(DEMCR_PTR) | DEMCR_TRCENA);
+    CY_SET_REG32(DWT_CYCCNT_PTR, 0u);
+    CY_SET_REG32(DWT_CTRL_PTR, CY_GET_REG32(DWT_CTRL_PTR) | DWT_CTRL_CYCCNTENA);
+
+    // Prepare the data set
+    expected = 0;
+    for (i = 0; i < SEG0_ITEMS; i++) {
+        seg0[i] = (uint16)((i * 2654435761u) & 0xFFFFu);
+        expected = (uint16)(expected + seg0[i]);
+    }
+    for (i = 0; i < SEG1_ITEMS; i++) {
+        seg1[i] = (uint16)((7919u + i * 2654435761u) & 0xFFFFu);
+        expected = (uint16)(expected + seg1[i]);
+    }
+    for (i = 0; i < SEG2_ITEMS; i++) {
+        seg2[i] = (uint16)((15838u + i * 2654435761u) & 0xFFFFu);
+        expected = (uint16)(expected + seg2[i]);
+    }
+
+    // DMA Configuration
+    DMA_Chan = DMA_DmaInitialize(
+        DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST,
+        HI16(DMA_SRC_BASE), HI16(DMA_DST_BASE)
+    );
+
+    // A bad segment list leaves no chain
+    bad.src = seg0;
+    bad.dst = ACC_INPUT_PTR;
+    bad.bytes = 0u;
+    bad.config = CY_DMA_TD_INC_SRC_ADR;
+    if (NtanDmaChain_Build(DMA_Chan, &bad, 1u, NtanDmaChain_ONCE) == CYRET_BAD_PARAM) params++;
+    bad.bytes = (NtanDmaChain_MAX_TDS + 1u) * NtanDmaChain_TD_SPLIT;
+    if (NtanDmaChain_Build(DMA_Chan, &bad, 1u, NtanDmaChain_ONCE) == CYRET_BAD_PARAM) params++;
+    if (NtanDmaChain_TdCount() != 0u) errors++;
+
+    segments[0].src = seg0;
+    segments[0].dst = ACC_INPUT_PTR;
+    segments[0].bytes = sizeof seg0;
+    segments[0].config = CY_DMA_TD_INC_SRC_ADR;
+    segments[1] = segments[0];
+    segments[1].src = seg1;
+    segments[1].bytes = sizeof seg1;
+    segments[2] = segments[0];
+    segments[2].src = seg2;
+    segments[2].bytes = sizeof seg2;
+    if (NtanDmaChain_Build(DMA_Chan, segments, 3u, NtanDmaChain_ONCE) != CYRET_SUCCESS) errors++;
+    if (NtanDmaChain_TdCount() != 4u) errors++;
+
+    // Initialize Ready interrupt
+    int_Ready_ClearPending();
+    int_Ready_StartEx(int_Ready_isr);
+
+    t0 = Cycles();
+    for (j = 0; j < BENCH_RUNS; j++) {
+        ACC_ClearAccumulator();
+        seen = 0;
+        NtanDmaChain_Start();
+
+        // Wait for calculation completed.
+        while (!int_Ready_Flag) {
+            active = NtanDmaChain_ActiveSegment();
+            if (active != 0xFFu) seen |= (uint8)(1u << active);
+        }
+        int_Ready_Flag = 0;
+        if (ACC_ReadAccumulator() != expected) errors++;
+    }
+    elapsed = Cycles() - t0;
+    NtanDmaChain_Free();
+
+    perItem = elapsed * 100u / (BENCH_RUNS * BENCH_ITEMS);
+    sprintf(sbuf, "runs=%lu items=%lu cycles/item=%lu.%02lu segments=%lu params=%lu check=%s\r\n",
+        (uint32)BENCH_RUNS, (uint32)BENCH_ITEMS, perItem / 100u, perItem % 100u,
+        (uint32)((seen & 1u) + ((seen >> 1) & 1u) + ((seen >> 2) & 1u)), (uint32)params,
+        (errors || seen != 0x07u || params != 2u) ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
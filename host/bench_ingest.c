@@ -0,0 +1,268 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Ingest benchmark of Accumulator8/16/32
+//
+// The same data set is fed into ACC by polling, by an interrupt
+// on dreq, and by DMA.  Every method is timed with the DWT cycle
+// counter and reported on the UART.
+//
+//   cycles/item  elapsed cycles per item
+//   cpu_free     share of the time the CPU was not feeding ACC
+//   latency      from the start until the result is readable
+//   drain        from the last write until the result is readable
+//
+// Instances: ACC, SR1 {busy, dreq}, UART, DMA on dreq with nrq
+// to int_DmaDone, int_Req on dreq (level), int_Ready unused.
+// Set BENCH_WIDTH to the width of ACC, and BENCH_INPUT_WIDTH and
+// BENCH_INPUT_SIGNED to InputWidth and InputSigned of Accumulator32.
+
+#include "project.h"
+#include <stdio.h>
+
+#if !defined(BENCH_WIDTH)
+#define BENCH_WIDTH     (16)
+#endif
+#if !defined(BENCH_INPUT_WIDTH)
+#define BENCH_INPUT_WIDTH   BENCH_WIDTH
+#endif
+#if !defined(BENCH_INPUT_SIGNED)
+#define BENCH_INPUT_SIGNED  (0)
+#endif
+#if !defined(BENCH_ITEMS)
+#define BENCH_ITEMS     (1000u)
+#endif
+
+// Cycles of exception entry and return, not seen by the counter
+#define BENCH_ISR_OVERHEAD  (24u)
+
+#if (BENCH_WIDTH == 32)
+typedef uint32 sum_t;
+#define SUM_MASK        (0xFFFFFFFFu)
+#elif (BENCH_WIDTH == 16)
+typedef uint16 sum_t;
+#define SUM_MASK        (0xFFFFu)
+#else
+typedef uint8 sum_t;
+#define SUM_MASK        (0xFFu)
+#endif
+
+// An item is extended to the sum as ACC does
+#if (BENCH_INPUT_WIDTH == 32)
+typedef uint32 item_t;
+#define ITEM_MASK       (0xFFFFFFFFu)
+#elif (BENCH_INPUT_WIDTH == 16)
+typedef uint16 item_t;
+#define ITEM_MASK       (0xFFFFu)
+#else
+typedef uint8 item_t;
+#define ITEM_MASK       (0xFFu)
+#endif
+#if (BENCH_INPUT_SIGNED && BENCH_INPUT_WIDTH == 16)
+#define EXTEND(x)       ((sum_t)(int16)(x))
+#elif (BENCH_INPUT_SIGNED && BENCH_INPUT_WIDTH == 8)
+#define EXTEND(x)       ((sum_t)(int8)(x))
+#else
+#define EXTEND(x)       ((sum_t)(x))
+#endif
+
+// Flag bit definition of SR1
+#define SR1_REQ     (1)
+#define SR1_BUSY    (2)
+
+// Cortex-M3 DWT cycle counter
+#if !defined(DWT_CYCCNT_PTR)
+#define DEMCR_PTR       ((reg32 *) 0xE000EDFCu)
+#define DWT_CTRL_PTR    ((reg32 *) 0xE0001000u)
+#define DWT_CYCCNT_PTR  ((reg32 *) 0xE0001004u)
+#endif
+#define DEMCR_TRCENA        (0x01000000u)
+#define DWT_CTRL_CYCCNTENA  (0x00000001u)
+#define Cycles()        CY_GET_REG32(DWT_CYCCNT_PTR)
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST (BENCH_INPUT_WIDTH / 8)
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA
+uint8 DMA_Chan;
+uint8 DMA_TD[1];
+
+// Data set and its sum
+item_t inData[BENCH_ITEMS];
+sum_t expected;
+
+// Shared with the interrupts
+volatile uint32 next;       // Index of the next item
+volatile uint32 tLast;      // Cycle of the last write
+volatile uint32 isrCycles;  // Cycles spent in the interrupts
+volatile CYBIT fed;         // All items written
+
+typedef struct {
+    uint32  elapsed;
+    uint32  busy;           // Cycles the CPU spent on feeding
+    uint32  drain;
+    sum_t   result;
+} Result;
+
+// Fill the FIFO while dreq is HIGH
+CY_ISR(int_Req_isr) {
+    uint32 t0 = Cycles();
+    do {
+        ACC_WriteValue(inData[next]);
+        if (++next >= BENCH_ITEMS) {
+            int_Req_Disable();
+            tLast = Cycles();
+            fed = 1;
+            break;
+        }
+    } while (SR1_Read() & SR1_REQ);
+    isrCycles += Cycles() - t0 + BENCH_ISR_OVERHEAD;
+}
+
+// The last burst of the TD is written
+CY_ISR(int_DmaDone_isr) {
+    uint32 t0 = Cycles();
+    tLast = t0;
+    fed = 1;
+    isrCycles += Cycles() - t0 + BENCH_ISR_OVERHEAD;
+}
+
+// Wait for ACC to add the FIFO and read the result
+static void Finish(Result *r, uint32 t0) {
+    uint32 t1 = Cycles();
+    uint32 t2;
+    while (SR1_Read() & SR1_BUSY) ;
+    r->result = ACC_ReadAccumulator();
+    t2 = Cycles();
+    r->elapsed = t2 - t0;
+    r->drain = t2 - tLast;
+    r->busy += t2 - t1;
+}
+
+static void RunPolled(Result *r) {
+    uint32 i, t0;
+    ACC_ClearAccumulator();
+    t0 = Cycles();
+    for (i = 0; i < BENCH_ITEMS; i++) {
+        while (!(SR1_Read() & SR1_REQ)) ;
+        ACC_WriteValue(inData[i]);
+    }
+    tLast = Cycles();
+    r->busy = tLast - t0;
+    Finish(r, t0);
+}
+
+static void RunIsr(Result *r) {
+    uint32 t0;
+    ACC_ClearAccumulator();
+    next = 0;
+    fed = 0;
+    isrCycles = 0;
+    t0 = Cycles();
+    int_Req_ClearPending();
+    int_Req_Enable();
+    r->busy = Cycles() - t0;
+    while (!fed) ;
+    r->busy += isrCycles;
+    Finish(r, t0);
+}
+
+static void RunDma(Result *r) {
+    uint32 t0;
+    ACC_ClearAccumulator();
+    fed = 0;
+    isrCycles = 0;
+    t0 = Cycles();
+    CyDmaChEnable(DMA_Chan, 1);
+    r->busy = Cycles() - t0;
+    while (!fed) ;
+    r->busy += isrCycles;
+    Finish(r, t0);
+}
+
+// Narrow input as /s8 for signed 8 bits or /u16 for unsigned 16 bits
+#if (BENCH_INPUT_WIDTH == BENCH_WIDTH)
+#define INPUT_NAME      ""
+#elif (BENCH_INPUT_SIGNED)
+#define INPUT_NAME      ((BENCH_INPUT_WIDTH == 8) ? "/s8" : "/s16")
+#else
+#define INPUT_NAME      ((BENCH_INPUT_WIDTH == 8) ? "/u8" : "/u16")
+#endif
+
+static void Report(const char *name, const Result *r) {
+    char sbuf[128];
+    uint32 perItem = r->elapsed * 100u / BENCH_ITEMS;
+    uint32 busy = (r->busy > r->elapsed) ? r->elapsed : r->busy;
+    sprintf(sbuf, "ACC%d%s %-6s items=%lu cycles/item=%lu.%02lu cpu_free=%lu%% latency=%lu drain=%lu check=%s\r\n",
+        BENCH_WIDTH, INPUT_NAME, name, (uint32)BENCH_ITEMS, perItem / 100u, perItem % 100u,
+        (r->elapsed - busy) * 100u / r->elapsed, r->elapsed, r->drain,
+        (r->result == expected) ? "ok" : "NG");
+    UART_PutString(sbuf);
+}
+
+int main(void) {
+    uint32 i;
+    Result r;
+    
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nINGEST BENCHMARK\r\n");
+
+    // Start the cycle counter
+    CY_SET_REG32(DEMCR_PTR, CY_GET_REG32(DEMCR_PTR) | DEMCR_TRCENA);
+    CY_SET_REG32(DWT_CYCCNT_PTR, 0u);
+    CY_SET_REG32(DWT_CTRL_PTR, CY_GET_REG32(DWT_CTRL_PTR) | DWT_CTRL_CYCCNTENA);
+
+    // Prepare the data set
+    expected = 0;
+    for (i = 0; i < BENCH_ITEMS; i++) {
+        inData[i] = (item_t)((i * 2654435761u) & ITEM_MASK);
+        expected = (sum_t)((expected + EXTEND(inData[i])) & SUM_MASK);
+    }
+
+    // DMA Configuration
+    DMA_Chan = DMA_DmaInitialize(
+        DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST, 
+        HI16(DMA_SRC_BASE), HI16(DMA_DST_BASE)
+    );
+    DMA_TD[0] = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(
+        DMA_TD[0],
+        sizeof inData, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR | CY_DMA_TD_TERMOUT0_EN
+    );
+    CyDmaTdSetAddress(DMA_TD[0], LO16((uint32)inData), LO16((uint32)ACC_INPUT_PTR));
+    CyDmaChSetInitialTd(DMA_Chan, DMA_TD[0]);
+
+    // Initialize the interrupts
+    int_Req_StartEx(int_Req_isr);
+    int_Req_Disable();
+    int_DmaDone_ClearPending();
+    int_DmaDone_StartEx(int_DmaDone_isr);
+
+    RunPolled(&r);
+    Report("polled", &r);
+    RunIsr(&r);
+    Report("isr", &r);
+    RunDma(&r);
+    Report("dma", &r);
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,132 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Result record benchmark of Accumulator16 with ResultFifo=1
+//
+// BENCH_BATCHES batches of BENCH_ITEMS words are summed by ACC
+// fed by DMA.  After starting a batch the CPU is kept away for a
+// different time on every batch, then reads the record of the sum
+// and its timestamp.  The duration of a batch is taken from the
+// timestamp (hw) and from the time the CPU read the record (sw).
+//
+//   hw  min/max of the batch duration by the timestamp
+//   sw  min/max of the batch duration seen by the CPU
+//
+// Instances: ACC (Accumulator16, ResultFifo=1), TS (NtanTimestamp,
+// Width=32, CAPTURE on DONE of ACC, on BUS_CLK), DMA on dreq,
+// int_Ready on the falling edge of BUSY, and UART.
+
+#include "project.h"
+#include <stdio.h>
+
+#if !defined(BENCH_BATCHES)
+#define BENCH_BATCHES   (8u)
+#endif
+#if !defined(BENCH_ITEMS)
+#define BENCH_ITEMS     (256u)
+#endif
+#if !defined(BENCH_WORK_STEP)
+#define BENCH_WORK_STEP (2000u)     // Cycles the CPU is away per batch
+#endif
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST 2
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA
+uint8 DMA_Chan;
+uint8 DMA_TD[1];
+
+// Data set and its sum per batch
+uint16 inData[BENCH_BATCHES][BENCH_ITEMS];
+uint16 expected[BENCH_BATCHES];
+
+// Accumulator Ready Detection
+volatile uint8 int_Ready_Flag = 0;
+
+CY_ISR(int_Ready_isr) {
+    int_Ready_Flag = 1;
+}
+
+int main(void) {
+    uint32 i, j;
+    uint32 start, stamp, seen;
+    uint32 hwMin = 0xFFFFFFFFu, hwMax = 0;
+    uint32 swMin = 0xFFFFFFFFu, swMax = 0;
+    uint8 errors = 0;
+    char sbuf[128];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nRECORD BENCHMARK\r\n");
+
+    // Prepare the data set
+    for (j = 0; j < BENCH_BATCHES; j++) {
+        expected[j] = 0;
+        for (i = 0; i < BENCH_ITEMS; i++) {
+            inData[j][i] = (uint16)((j * 7919u + i * 2654435761u) & 0xFFFFu);
+            expected[j] = (uint16)(expected[j] + inData[j][i]);
+        }
+    }
+
+    // DMA Configuration
+    DMA_Chan = DMA_DmaInitialize(
+        DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST,
+        HI16(DMA_SRC_BASE), HI16(DMA_DST_BASE)
+    );
+    DMA_TD[0] = CyDmaTdAllocate();
+    CyDmaChSetInitialTd(DMA_Chan, DMA_TD[0]);
+
+    // Initialize Ready interrupt
+    int_Ready_ClearPending();
+    int_Ready_StartEx(int_Ready_isr);
+
+    for (j = 0; j < BENCH_BATCHES; j++) {
+        ACC_ClearAccumulator();
+        CyDmaTdSetConfiguration(DMA_TD[0],
+            sizeof inData[j], CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+        CyDmaTdSetAddress(DMA_TD[0], LO16((uint32)inData[j]), LO16((uint32)ACC_INPUT_PTR));
+        start = TS_ReadCount();
+        CyDmaChEnable(DMA_Chan, 1);
+
+        // Other work
+        while (TS_ReadCount() - start < j * BENCH_WORK_STEP) ;
+
+        // Wait for calculation completed.
+        while (!int_Ready_Flag) ;
+        int_Ready_Flag = 0;
+
+        // Read the record
+        if (ACC_ReadResult() != expected[j]) errors++;
+        stamp = TS_ReadTimestamp() - start;
+        seen = TS_ReadCount() - start;
+        if (stamp < hwMin) hwMin = stamp;
+        if (stamp > hwMax) hwMax = stamp;
+        if (seen < swMin) swMin = seen;
+        if (seen > swMax) swMax = seen;
+    }
+
+    sprintf(sbuf, "batches=%lu items=%lu hw=%lu/%lu sw=%lu/%lu check=%s\r\n",
+        (uint32)BENCH_BATCHES, (uint32)BENCH_ITEMS,
+        hwMin, hwMax, swMin, swMax, errors ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
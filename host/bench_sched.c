@@ -0,0 +1,130 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Throughput benchmark of NtanAccScheduler
+//
+// BENCH_JOBS jobs of BENCH_ITEMS words are summed on BENCH_LANES
+// Accumulator16 lanes.  The elapsed cycles are reported on the
+// UART with the sum of every job checked.
+//
+// Sources: Shared/NtanAccScheduler.c
+// Instances: ACC_1 to ACC_n with ResultFifo=1 and DMA_1 to DMA_n
+// on their dreq, SR_Done in the sticky mode with DONE of ACC_n at
+// bit n-1, and UART.  Poll() is paced to one ACC clock,
+// BENCH_ACC_CLOCK cycles of BUS_CLK.
+
+#include "project.h"
+#include "NtanAccScheduler.h"
+#include <stdio.h>
+
+#if !defined(BENCH_LANES)
+#define BENCH_LANES     (1u)
+#endif
+#if !defined(BENCH_JOBS)
+#define BENCH_JOBS      (16u)
+#endif
+#if !defined(BENCH_ITEMS)
+#define BENCH_ITEMS     (256u)
+#endif
+#if !defined(BENCH_ACC_CLOCK)
+#define BENCH_ACC_CLOCK (16u)
+#endif
+
+// Cortex-M3 DWT cycle counter
+#if !defined(DWT_CYCCNT_PTR)
+#define DEMCR_PTR       ((reg32 *) 0xE000EDFCu)
+#define DWT_CTRL_PTR    ((reg32 *) 0xE0001000u)
+#define DWT_CYCCNT_PTR  ((reg32 *) 0xE0001004u)
+#endif
+#define DEMCR_TRCENA        (0x01000000u)
+#define DWT_CTRL_CYCCNTENA  (0x00000001u)
+#define Cycles()        CY_GET_REG32(DWT_CYCCNT_PTR)
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST 2
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Data set and its sum per job
+uint16 inData[BENCH_JOBS][BENCH_ITEMS];
+uint16 expected[BENCH_JOBS];
+uint16 result[BENCH_JOBS];
+
+static void Done(uint32 sum, void *context) {
+    result[(uint16 *)context - expected] = (uint16)sum;
+}
+
+int main(void) {
+    uint32 i, j;
+    uint32 t0, elapsed, perItem;
+    uint32 submitted = 0;
+    uint8 errors = 0;
+    char sbuf[128];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nSCHEDULER BENCHMARK\r\n");
+
+    // Start the cycle counter
+    CY_SET_REG32(DEMCR_PTR, CY_GET_REG32(DEMCR_PTR) | DEMCR_TRCENA);
+    CY_SET_REG32(DWT_CYCCNT_PTR, 0u);
+    CY_SET_REG32(DWT_CTRL_PTR, CY_GET_REG32(DWT_CTRL_PTR) | DWT_CTRL_CYCCNTENA);
+
+    // Prepare the data set
+    for (j = 0; j < BENCH_JOBS; j++) {
+        expected[j] = 0;
+        for (i = 0; i < BENCH_ITEMS; i++) {
+            inData[j][i] = (uint16)((j * 7919u + i * 2654435761u) & 0xFFFFu);
+            expected[j] = (uint16)(expected[j] + inData[j][i]);
+        }
+    }
+
+    // A DMA channel per lane
+    NtanAccScheduler_Start();
+    for (i = 1; i <= BENCH_LANES; i++) {
+        uint8 ch = DMA_n_DmaInitialize(i,
+            DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST);
+        NtanAccScheduler_AddLane(ACC_n_INPUT_PTR(i), ACC_n_ACCUMULATOR_PTR(i),
+            ACC_n_RESULT_PTR(i), 2u, ch, SR_Done_Status_PTR, (uint8)(1u << (i - 1u)));
+    }
+
+    t0 = Cycles();
+    while (NtanAccScheduler_Completed() < BENCH_JOBS) {
+        uint32 t1 = Cycles();
+        while (submitted < BENCH_JOBS
+                && NtanAccScheduler_Submit(inData[submitted], BENCH_ITEMS,
+                    Done, &expected[submitted]) == CYRET_SUCCESS) {
+            submitted++;
+        }
+        NtanAccScheduler_Poll();
+        while (Cycles() - t1 < BENCH_ACC_CLOCK) ;
+    }
+    elapsed = Cycles() - t0;
+
+    for (j = 0; j < BENCH_JOBS; j++) {
+        if (result[j] != expected[j]) errors++;
+    }
+    perItem = elapsed * 100u / (BENCH_JOBS * BENCH_ITEMS);
+    sprintf(sbuf, "lanes=%lu jobs=%lu items=%lu cycles=%lu cycles/item=%lu.%02lu check=%s\r\n",
+        (uint32)BENCH_LANES, (uint32)BENCH_JOBS, (uint32)BENCH_ITEMS, elapsed,
+        perItem / 100u, perItem % 100u, errors ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,205 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Result telemetry benchmark of NtanHexFormatter
+//
+// BENCH_BATCHES batches of BENCH_ITEMS words are summed by ACC
+// fed by DMA, and every sum is sent on UartTx as a line "S=XXXX",
+// or "S=DDDDD" with Fmt_DECIMAL.
+//   BENCH_HW=0  the CPU reads the sum, formats it with sprintf()
+//               and sends the line with UartTx_Send()
+//   BENCH_HW=1  DMA_Result moves the sum into Fmt and DMA_Fmt the
+//               characters into UartTx, without the CPU
+//
+//   cpu/line  cycles the CPU spent on a line after int_Ready
+//   elapsed   cycles up to the last line queued in UartTx
+//
+// Instances: ACC (Accumulator16, ResultFifo=1), DMA on dreq,
+// int_Ready on the falling edge of BUSY, Fmt (NtanHexFormatter,
+// Width=16, Terminator=CR LF, Decimal as Fmt_DECIMAL), DMA_Result from RESULT of ACC into
+// INPUT of Fmt on DONE, UartTx (NtanUartTx), DMA_Fmt from OUTPUT
+// of Fmt into INPUT of UartTx on TX_REQ of Fmt with TX_DREQ from
+// UartTx, DMA_UartTx on dreq of UartTx, and UART.
+
+#include "project.h"
+#include <stdio.h>
+
+#if !defined(BENCH_HW)
+#define BENCH_HW        (1)
+#endif
+#if !defined(BENCH_BATCHES)
+#define BENCH_BATCHES   (8u)
+#endif
+#if !defined(BENCH_ITEMS)
+#define BENCH_ITEMS     (256u)
+#endif
+#if !defined(BENCH_DRAIN)
+#define BENCH_DRAIN     (12480u)    // 6 characters at 115200bps from 24MHz
+#endif
+
+// Characters of a line with the prefix
+#define LINE_CHARS      (2u + Fmt_LINE_LENGTH)
+
+// Cortex-M3 DWT cycle counter
+#if !defined(DWT_CYCCNT_PTR)
+#define DEMCR_PTR       ((reg32 *) 0xE000EDFCu)
+#define DWT_CTRL_PTR    ((reg32 *) 0xE0001000u)
+#define DWT_CYCCNT_PTR  ((reg32 *) 0xE0001004u)
+#endif
+#define DEMCR_TRCENA        (0x01000000u)
+#define DWT_CTRL_CYCCNTENA  (0x00000001u)
+#define Cycles()        CY_GET_REG32(DWT_CYCCNT_PTR)
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST 2
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA
+uint8 DMA_Chan;
+uint8 DMA_TD[1];
+
+// Data set
+uint16 inData[BENCH_BATCHES][BENCH_ITEMS];
+
+// Line formatted by the CPU
+char8 line[16];
+
+// Accumulator Ready Detection
+volatile uint8 int_Ready_Flag = 0;
+
+CY_ISR(int_Ready_isr) {
+    int_Ready_Flag = 1;
+}
+
+int main(void) {
+    uint32 i, j;
+    uint32 t0, t1, elapsed;
+    uint32 cpu = 0;
+    uint8 state;
+    char sbuf[128];
+#if (BENCH_HW)
+    uint8 resultChan, fmtChan;
+    uint8 resultTd, fmtTd;
+#else
+    uint8 txChan;
+    UartTx_segment segment;
+#endif
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nTELEMETRY BENCHMARK\r\n");
+
+    // Start the cycle counter
+    CY_SET_REG32(DEMCR_PTR, CY_GET_REG32(DEMCR_PTR) | DEMCR_TRCENA);
+    CY_SET_REG32(DWT_CYCCNT_PTR, 0u);
+    CY_SET_REG32(DWT_CTRL_PTR, CY_GET_REG32(DWT_CTRL_PTR) | DWT_CTRL_CYCCNTENA);
+
+    // Prepare the data set
+    for (j = 0; j < BENCH_BATCHES; j++) {
+        for (i = 0; i < BENCH_ITEMS; i++) {
+            inData[j][i] = (uint16)((j * 7919u + i * 2654435761u) & 0xFFFFu);
+        }
+    }
+
+    // DMA Configuration
+    DMA_Chan = DMA_DmaInitialize(
+        DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST,
+        HI16(DMA_SRC_BASE), HI16(DMA_DST_BASE)
+    );
+    DMA_TD[0] = CyDmaTdAllocate();
+    CyDmaChSetInitialTd(DMA_Chan, DMA_TD[0]);
+
+#if (BENCH_HW)
+    // Every sum into Fmt, and every character into UartTx.
+    // Both are peripheral to peripheral transfers.
+    Fmt_SetPrefix('S', '=');
+    resultChan = DMA_Result_DmaInitialize(2u, 1u,
+        HI16(CYDEV_PERIPH_BASE), HI16(CYDEV_PERIPH_BASE));
+    resultTd = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(resultTd, 2u * BENCH_BATCHES, CY_DMA_DISABLE_TD, 0u);
+    CyDmaTdSetAddress(resultTd, LO16((uint32)ACC_RESULT_PTR), LO16((uint32)Fmt_INPUT_PTR));
+    CyDmaChSetInitialTd(resultChan, resultTd);
+    CyDmaChEnable(resultChan, 1);
+    fmtChan = DMA_Fmt_DmaInitialize(1u, 1u,
+        HI16(CYDEV_PERIPH_BASE), HI16(CYDEV_PERIPH_BASE));
+    fmtTd = CyDmaTdAllocate();
+    CyDmaTdSetConfiguration(fmtTd, LINE_CHARS * BENCH_BATCHES, CY_DMA_DISABLE_TD, 0u);
+    CyDmaTdSetAddress(fmtTd, LO16((uint32)Fmt_OUTPUT_PTR), LO16((uint32)UartTx_INPUT_PTR));
+    CyDmaChSetInitialTd(fmtChan, fmtTd);
+    CyDmaChEnable(fmtChan, 1);
+#else
+    txChan = DMA_UartTx_DmaInitialize(1u, 1u,
+        HI16(CYDEV_SRAM_BASE), HI16(CYDEV_PERIPH_BASE));
+    segment.data = line;
+#endif
+
+    // Initialize Ready interrupt
+    int_Ready_ClearPending();
+    int_Ready_StartEx(int_Ready_isr);
+
+    t0 = Cycles();
+    for (j = 0; j < BENCH_BATCHES; j++) {
+        ACC_ClearAccumulator();
+        CyDmaTdSetConfiguration(DMA_TD[0],
+            sizeof inData[j], CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+        CyDmaTdSetAddress(DMA_TD[0], LO16((uint32)inData[j]), LO16((uint32)ACC_INPUT_PTR));
+        CyDmaChEnable(DMA_Chan, 1);
+
+        // Wait for calculation completed.
+        while (!int_Ready_Flag) ;
+        int_Ready_Flag = 0;
+
+        // Report the sum
+        t1 = Cycles();
+#if (!BENCH_HW)
+        while (UartTx_Busy()) ;
+#if (Fmt_DECIMAL)
+        sprintf(line, "S=%05u\r\n", (unsigned)ACC_ReadResult());
+#else
+        sprintf(line, "S=%04X\r\n", ACC_ReadResult());
+#endif
+        segment.bytes = LINE_CHARS;
+        UartTx_Send(txChan, &segment, 1u);
+#endif
+        cpu += Cycles() - t1;
+    }
+
+    // Wait for the last line
+#if (BENCH_HW)
+    do {
+        CyDmaChStatus(fmtChan, NULL, &state);
+    } while (state & CY_DMA_STATUS_CHAIN_ACTIVE);
+#else
+    while (UartTx_Busy()) ;
+    (void)state;
+#endif
+    elapsed = Cycles() - t0;
+
+    // Let the FIFO and the shifter of UartTx drain before the report
+    t1 = Cycles();
+    while (Cycles() - t1 < BENCH_DRAIN) ;
+
+    sprintf(sbuf, "report=%s batches=%lu items=%lu cpu/line=%lu elapsed=%lu\r\n",
+        BENCH_HW ? "hw" : "sw", (uint32)BENCH_BATCHES, (uint32)BENCH_ITEMS,
+        cpu / BENCH_BATCHES, elapsed);
+    UART_PutString(sbuf);
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
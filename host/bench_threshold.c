@@ -0,0 +1,181 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Threshold detection benchmark of Accumulator16
+//
+// BENCH_BATCHES batches of BENCH_ITEMS words are summed by ACC fed
+// by DMA, each with the threshold at a different part of its sum.
+// The crossing is detected by reading the sum every BENCH_POLL
+// cycles (BENCH_IRQ=0) or by int_Over on OVER_THRESHOLD, which
+// reads the sum in its handler (BENCH_IRQ=1).  The words summed
+// after the crossing, when the sum is read, are reported.
+//
+//   reads      register reads of the sum in all batches
+//   overshoot  mean and max of the words summed after the crossing
+//
+// The end of a batch is waited for on int_Ready, so the rest of
+// the batch adds no reads.
+//
+// Instances: ACC (Accumulator16), DMA on dreq, int_Over on the
+// rising edge of OVER_THRESHOLD, int_Ready on the falling edge of
+// BUSY, and UART.
+
+#include "project.h"
+#include <stdio.h>
+
+#if !defined(BENCH_IRQ)
+#define BENCH_IRQ       (0u)
+#endif
+#if !defined(BENCH_BATCHES)
+#define BENCH_BATCHES   (8u)
+#endif
+#if !defined(BENCH_ITEMS)
+#define BENCH_ITEMS     (256u)
+#endif
+#if !defined(BENCH_POLL)
+#define BENCH_POLL      (500u)      // Cycles of other work per poll
+#endif
+
+// Cortex-M3 DWT cycle counter
+#if !defined(DWT_CYCCNT_PTR)
+#define DEMCR_PTR       ((reg32 *) 0xE000EDFCu)
+#define DWT_CTRL_PTR    ((reg32 *) 0xE0001000u)
+#define DWT_CYCCNT_PTR  ((reg32 *) 0xE0001004u)
+#endif
+#define DEMCR_TRCENA        (0x01000000u)
+#define DWT_CTRL_CYCCNTENA  (0x00000001u)
+#define Cycles()        CY_GET_REG32(DWT_CYCCNT_PTR)
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST 2
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA
+uint8 DMA_Chan;
+uint8 DMA_TD[1];
+
+// Data set of small words, so that the sum never wraps
+uint16 inData[BENCH_ITEMS];
+uint16 partial[BENCH_ITEMS];
+
+// Sum read at the crossing
+volatile uint8 int_Over_Flag = 0;
+volatile uint16 overSum;
+
+CY_ISR(int_Over_isr) {
+    overSum = ACC_ReadAccumulator();
+    int_Over_Flag = 1;
+}
+
+// Accumulator Ready Detection
+volatile uint8 int_Ready_Flag = 0;
+
+CY_ISR(int_Ready_isr) {
+    int_Ready_Flag = 1;
+}
+
+int main(void) {
+    uint32 i, j;
+    uint32 reads = 0;
+    uint32 over, overTotal = 0, overMax = 0;
+    uint16 threshold, sum = 0;
+    uint8 errors = 0;
+    char sbuf[128];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nTHRESHOLD BENCHMARK\r\n");
+
+    // Start the cycle counter
+    CY_SET_REG32(DEMCR_PTR, CY_GET_REG32(DEMCR_PTR) | DEMCR_TRCENA);
+    CY_SET_REG32(DWT_CYCCNT_PTR, 0u);
+    CY_SET_REG32(DWT_CTRL_PTR, CY_GET_REG32(DWT_CTRL_PTR) | DWT_CTRL_CYCCNTENA);
+
+    // Prepare the data set
+    for (i = 0; i < BENCH_ITEMS; i++) {
+        inData[i] = (uint16)(((i * 2654435761u) >> 16) & 0x3Fu) | 1u;
+        sum = (uint16)(sum + inData[i]);
+        partial[i] = sum;
+    }
+
+    // DMA Configuration
+    DMA_Chan = DMA_DmaInitialize(
+        DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST,
+        HI16(DMA_SRC_BASE), HI16(DMA_DST_BASE)
+    );
+    DMA_TD[0] = CyDmaTdAllocate();
+    CyDmaChSetInitialTd(DMA_Chan, DMA_TD[0]);
+
+    // Initialize Ready interrupt
+    int_Ready_ClearPending();
+    int_Ready_StartEx(int_Ready_isr);
+
+#if BENCH_IRQ
+    // Initialize Over Threshold interrupt
+    int_Over_ClearPending();
+    int_Over_StartEx(int_Over_isr);
+#endif
+
+    for (j = 0; j < BENCH_BATCHES; j++) {
+        threshold = (uint16)((uint32)sum * (j + 1u) / (BENCH_BATCHES + 1u));
+        ACC_ClearAccumulator();
+        ACC_SetThreshold(threshold);
+        int_Over_Flag = 0;
+        int_Ready_Flag = 0;
+        CyDmaTdSetConfiguration(DMA_TD[0],
+            sizeof inData, CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+        CyDmaTdSetAddress(DMA_TD[0], LO16((uint32)inData), LO16((uint32)ACC_INPUT_PTR));
+        CyDmaChEnable(DMA_Chan, 1);
+
+#if BENCH_IRQ
+        // Other work until the interrupt
+        while (!int_Over_Flag) ;
+        reads++;
+#else
+        // Other work between polls
+        for (;;) {
+            uint32 t1 = Cycles();
+            overSum = ACC_ReadAccumulator();
+            reads++;
+            if (overSum > threshold) break;
+            while (Cycles() - t1 < BENCH_POLL) ;
+        }
+#endif
+
+        // Words summed after the crossing
+        for (i = 0; partial[i] <= threshold; i++) ;
+        for (over = 0; i + over < BENCH_ITEMS && partial[i + over] != overSum; over++) ;
+        if (i + over >= BENCH_ITEMS) errors++;
+        overTotal += over;
+        if (over > overMax) overMax = over;
+
+        // Wait for the rest of the batch
+        while (!int_Ready_Flag) ;
+        if (ACC_ReadAccumulator() != sum) errors++;
+    }
+
+    sprintf(sbuf, "detect=%s batches=%lu items=%lu reads=%lu overshoot=%lu.%02lu/%lu check=%s\r\n",
+        BENCH_IRQ ? "irq" : "poll", (uint32)BENCH_BATCHES, (uint32)BENCH_ITEMS, reads,
+        overTotal / BENCH_BATCHES, overTotal * 100u / BENCH_BATCHES % 100u, overMax,
+        errors ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
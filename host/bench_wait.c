@@ -0,0 +1,148 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Wait benchmark of NtanSleepWait
+//
+// BENCH_BATCHES batches of BENCH_ITEMS words are summed by ACC
+// fed by DMA.  The end of a batch is waited for by spinning on
+// the int_Ready flag, or with the CPU asleep in
+// NtanSleepWait_WaitFlag() when BENCH_SLEEP is 1.
+//
+//   cycles/item  elapsed cycles per item
+//   latency      from int_Ready to the result read, mean and max
+//   wakeups      times the CPU woke up from WFI
+//
+// Sources: Shared/NtanSleepWait.c
+// Instances: ACC (Accumulator16), DMA on dreq, int_Ready on the
+// falling edge of BUSY, and UART.
+
+#include "project.h"
+#include "NtanSleepWait.h"
+#include <stdio.h>
+
+#if !defined(BENCH_SLEEP)
+#define BENCH_SLEEP     (1)
+#endif
+#if !defined(BENCH_BATCHES)
+#define BENCH_BATCHES   (8u)
+#endif
+#if !defined(BENCH_ITEMS)
+#define BENCH_ITEMS     (256u)
+#endif
+
+// Cortex-M3 DWT cycle counter
+#if !defined(DWT_CYCCNT_PTR)
+#define DEMCR_PTR       ((reg32 *) 0xE000EDFCu)
+#define DWT_CTRL_PTR    ((reg32 *) 0xE0001000u)
+#define DWT_CYCCNT_PTR  ((reg32 *) 0xE0001004u)
+#endif
+#define DEMCR_TRCENA        (0x01000000u)
+#define DWT_CTRL_CYCCNTENA  (0x00000001u)
+#define Cycles()        CY_GET_REG32(DWT_CYCCNT_PTR)
+
+// Defines for DMA
+#define DMA_BYTES_PER_BURST 2
+#define DMA_REQUEST_PER_BURST 1
+#define DMA_SRC_BASE (CYDEV_SRAM_BASE)
+#define DMA_DST_BASE (CYDEV_PERIPH_BASE)
+
+// Variable declarations for DMA
+uint8 DMA_Chan;
+uint8 DMA_TD[1];
+
+// Data set and its sum per batch
+uint16 inData[BENCH_BATCHES][BENCH_ITEMS];
+uint16 expected[BENCH_BATCHES];
+
+// Accumulator Ready Detection
+volatile uint8 int_Ready_Flag = 0;
+volatile uint32 readyAt;    // Cycle of the interrupt
+
+CY_ISR(int_Ready_isr) {
+    readyAt = Cycles();
+    int_Ready_Flag = 1;
+}
+
+int main(void) {
+    uint32 i, j;
+    uint32 t0, elapsed, perItem;
+    uint32 latency, latencySum = 0, latencyMax = 0;
+    uint8 errors = 0;
+    char sbuf[128];
+
+    CyGlobalIntEnable; /* Enable global interrupts. */
+
+    // Initialize UART
+    UART_Start();
+    UART_PutStringConst("\r\nWAIT BENCHMARK\r\n");
+
+    // Start the cycle counter
+    CY_SET_REG32(DEMCR_PTR, CY_GET_REG32(DEMCR_PTR) | DEMCR_TRCENA);
+    CY_SET_REG32(DWT_CYCCNT_PTR, 0u);
+    CY_SET_REG32(DWT_CTRL_PTR, CY_GET_REG32(DWT_CTRL_PTR) | DWT_CTRL_CYCCNTENA);
+
+    // Prepare the data set
+    for (j = 0; j < BENCH_BATCHES; j++) {
+        expected[j] = 0;
+        for (i = 0; i < BENCH_ITEMS; i++) {
+            inData[j][i] = (uint16)((j * 7919u + i * 2654435761u) & 0xFFFFu);
+            expected[j] = (uint16)(expected[j] + inData[j][i]);
+        }
+    }
+
+    // DMA Configuration
+    DMA_Chan = DMA_DmaInitialize(
+        DMA_BYTES_PER_BURST, DMA_REQUEST_PER_BURST,
+        HI16(DMA_SRC_BASE), HI16(DMA_DST_BASE)
+    );
+    DMA_TD[0] = CyDmaTdAllocate();
+    CyDmaChSetInitialTd(DMA_Chan, DMA_TD[0]);
+
+    // Initialize Ready interrupt
+    int_Ready_ClearPending();
+    int_Ready_StartEx(int_Ready_isr);
+
+    t0 = Cycles();
+    for (j = 0; j < BENCH_BATCHES; j++) {
+        ACC_ClearAccumulator();
+        CyDmaTdSetConfiguration(DMA_TD[0],
+            sizeof inData[j], CY_DMA_DISABLE_TD, CY_DMA_TD_INC_SRC_ADR);
+        CyDmaTdSetAddress(DMA_TD[0], LO16((uint32)inData[j]), LO16((uint32)ACC_INPUT_PTR));
+        CyDmaChEnable(DMA_Chan, 1);
+
+        // Wait for calculation completed.
+#if (BENCH_SLEEP)
+        NtanSleepWait_WaitFlag(&int_Ready_Flag);
+#else
+        while (!int_Ready_Flag) ;
+        int_Ready_Flag = 0;
+#endif
+        if (ACC_ReadAccumulator() != expected[j]) errors++;
+        latency = Cycles() - readyAt;
+        latencySum += latency;
+        if (latency > latencyMax) latencyMax = latency;
+    }
+    elapsed = Cycles() - t0;
+
+    perItem = elapsed * 100u / (BENCH_BATCHES * BENCH_ITEMS);
+    sprintf(sbuf, "wait=%s batches=%lu items=%lu cycles/item=%lu.%02lu latency=%lu/%lu wakeups=%lu check=%s\r\n",
+        BENCH_SLEEP ? "sleep" : "spin", (uint32)BENCH_BATCHES, (uint32)BENCH_ITEMS,
+        perItem / 100u, perItem % 100u, latencySum / BENCH_BATCHES, latencyMax,
+        BENCH_SLEEP ? NtanSleepWait_Wakeups() : 0u, errors ? "NG" : "ok");
+    UART_PutString(sbuf);
+
+    for(;;) {
+        /* Place your application code here. */
+    }
+}
+
+/* [] END OF FILE */
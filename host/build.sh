@@ -0,0 +1,115 @@
+#!/bin/sh
+# ========================================
+#
+# Build the test firmware for the host.  Run from the top of
+# the repository.
+#
+#   sh host/build.sh [project ...]
+#
+# The executables go to host/out.  Extra compiler flags can be
+# given in CFLAGS, e.g. CFLAGS=-DHOST_COST_REG=5
+#
+# ========================================
+
+CC=${CC:-cc}
+HOST=host
+OUT=$HOST/out
+SHARED=Shared
+
+# Instance set of every test project
+# The Accumulator tests clock ACC slowly to watch it, so the
+# FIFO is kept ahead of the DMA and BUSY falls only once.
+defines() {
+    case $1 in
+        Accumulator8Test01)     echo -DHOST_ACC_WIDTH=8 -DHOST_ACC_DIV=16 ;;
+        Accumulator16Test01)    echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 ;;
+        Input_FIFO_8)           echo -DHOST_ACC_WIDTH=8 ;;
+        Input_FIFO_16)          echo -DHOST_ACC_WIDTH=16 ;;
+        Input_FIFO_32)          echo -DHOST_ACC_WIDTH=32 ;;
+        PureRegisterTest01)     echo -DHOST_PR_WIDTH=8 ;;
+        PureRegisterTest02)     echo -DHOST_PR_WIDTH=16 ;;
+        PureRegisterTest03)     echo -DHOST_PR_WIDTH=32 ;;
+        UartTxTest0[123])       echo -DHOST_UARTTX ;;
+        UartTxGeneratorFreeSoc2) echo -DHOST_UARTTX ;;
+        IngestBench8)           echo -DHOST_ACC_WIDTH=8 -DBENCH_WIDTH=8 ;;
+        IngestBench16)          echo -DHOST_ACC_WIDTH=16 -DBENCH_WIDTH=16 ;;
+        IngestBench32)          echo -DHOST_ACC_WIDTH=32 -DBENCH_WIDTH=32 ;;
+        IngestBench32s8)        echo -DHOST_ACC_WIDTH=32 -DBENCH_WIDTH=32 \
+                                    -DHOST_ACC_INPUT_WIDTH=8 -DHOST_ACC_INPUT_SIGNED=1 \
+                                    -DBENCH_INPUT_WIDTH=8 -DBENCH_INPUT_SIGNED=1 ;;
+        IngestBench32s16)       echo -DHOST_ACC_WIDTH=32 -DBENCH_WIDTH=32 \
+                                    -DHOST_ACC_INPUT_WIDTH=16 -DHOST_ACC_INPUT_SIGNED=1 \
+                                    -DBENCH_INPUT_WIDTH=16 -DBENCH_INPUT_SIGNED=1 ;;
+        IngestBench32u16)       echo -DHOST_ACC_WIDTH=32 -DBENCH_WIDTH=32 \
+                                    -DHOST_ACC_INPUT_WIDTH=16 -DBENCH_INPUT_WIDTH=16 ;;
+        SchedBench[12])         n=${1#SchedBench}
+                                echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 \
+                                    -DHOST_ACC_LANES=$n -DBENCH_LANES=$n ;;
+        SchedBench4)            echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=24 -DBENCH_ACC_CLOCK=24 \
+                                    -DHOST_ACC_LANES=4 -DBENCH_LANES=4 ;;
+        ChainBench)             echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 ;;
+        RecordBench)            echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DHOST_ACC_RESULT_FIFO -DHOST_TS ;;
+        WaitBenchSpin)          echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DBENCH_SLEEP=0 ;;
+        WaitBenchSleep)         echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DBENCH_SLEEP=1 ;;
+        ThresholdBenchPoll)     echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DBENCH_IRQ=0 ;;
+        ThresholdBenchIrq)      echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DBENCH_IRQ=1 ;;
+        TelemetryBenchSw)       echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DHOST_ACC_RESULT_FIFO \
+                                    -DHOST_UARTTX -DHOST_HEXFMT=16 -DBENCH_HW=0 ;;
+        TelemetryBenchHw)       echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DHOST_ACC_RESULT_FIFO \
+                                    -DHOST_UARTTX -DHOST_HEXFMT=16 -DBENCH_HW=1 ;;
+        TelemetryBenchSwDec)    echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DHOST_ACC_RESULT_FIFO \
+                                    -DHOST_UARTTX -DHOST_HEXFMT=16 -DHOST_HEXFMT_DECIMAL=1 -DBENCH_HW=0 ;;
+        TelemetryBenchHwDec)    echo -DHOST_ACC_WIDTH=16 -DHOST_ACC_DIV=16 -DHOST_ACC_RESULT_FIFO \
+                                    -DHOST_UARTTX -DHOST_HEXFMT=16 -DHOST_HEXFMT_DECIMAL=1 -DBENCH_HW=1 ;;
+        *)                      return 1 ;;
+    esac
+}
+
+# Firmware source of a project
+source() {
+    case $1 in
+        IngestBench*)   echo "$HOST/bench_ingest.c" ;;
+        SchedBench*)    echo "$HOST/bench_sched.c $SHARED/NtanAccScheduler.c" ;;
+        WaitBench*)     echo "$HOST/bench_wait.c $SHARED/NtanSleepWait.c" ;;
+        ChainBench)     echo "$HOST/bench_chain.c $SHARED/NtanDmaChain.c" ;;
+        RecordBench)    echo "$HOST/bench_record.c" ;;
+        ThresholdBench*) echo "$HOST/bench_threshold.c" ;;
+        TelemetryBench*) echo "$HOST/bench_telemetry.c" ;;
+        *)              echo "$1.cydsn/main.c" ;;
+    esac
+}
+
+if [ $# -eq 0 ]; then
+    set -- Accumulator8Test01 Accumulator16Test01 \
+        Input_FIFO_8 Input_FIFO_16 Input_FIFO_32 \
+        PureRegisterTest01 PureRegisterTest02 PureRegisterTest03 \
+        UartTxTest01 UartTxTest02 UartTxTest03 UartTxGeneratorFreeSoc2 \
+        IngestBench8 IngestBench16 IngestBench32 \
+        IngestBench32s8 IngestBench32s16 IngestBench32u16 \
+        SchedBench1 SchedBench2 SchedBench4 ChainBench \
+        WaitBenchSpin WaitBenchSleep RecordBench \
+        ThresholdBenchPoll ThresholdBenchIrq \
+        TelemetryBenchSw TelemetryBenchHw \
+        TelemetryBenchSwDec TelemetryBenchHwDec
+fi
+
+mkdir -p "$OUT" || exit 1
+status=0
+for p in "$@"; do
+    if ! d=$(defines "$p"); then
+        echo "$p: unknown project" >&2
+        status=1
+        continue
+    fi
+    # -O0 keeps a loop on a non-volatile flag reading memory.
+    # "%ld" for uint32 and (uint32)pointer are right on the target.
+    if $CC -std=gnu99 -O0 -g -Wall -Wno-format -Wno-pointer-to-int-cast \
+            -no-pie -I"$HOST" -I"$SHARED" $d $CFLAGS \
+            -o "$OUT/$p" $(source "$p") \
+            "$HOST/project.c" "$HOST/cyhost.c" "$HOST/cyhost_dma.c" "$HOST/cyhost_models.c"; then
+        echo "$OUT/$p"
+    else
+        status=1
+    fi
+done
+exit $status
@@ -0,0 +1,25 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Host replacement of cyPm.h
+
+#if !defined(CY_HOST_CYPM_H)
+#define CY_HOST_CYPM_H
+
+#include "cytypes.h"
+
+// The time goes without the CPU up to a pending interrupt
+extern void Host_Wfi(void);
+#define CY_PM_WFI       Host_Wfi()
+
+#endif  // CY_HOST_CYPM_H
+/* [] END OF FILE */
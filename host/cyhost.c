@@ -0,0 +1,379 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "cyhost.h"
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// Run control from the environment
+//   HOST_RUN_CYCLES  end of the run in cycles
+//   HOST_SW_PRESS    cycle when the switch is pushed
+//   HOST_SW_RELEASE  cycle when the switch is released
+//   HOST_TRACE       stamp every console line on stderr
+//   HOST_TIMEOUT     wall clock limit in seconds
+static unsigned long long runCycles = 2000000ull;
+static unsigned long long swPress = 10000ull;
+static unsigned long long swRelease = 1000000ull;
+static int trace = 0;
+static uint8 swUsed = 0u;                   // The switch has been read
+
+static volatile unsigned long long cycles = 0;
+static volatile int depth = 0;              // Nesting of host calls
+static volatile unsigned long accesses = 0; // CPU accesses so far
+static volatile uint8 intEnabled = 0;
+static volatile uint8 inIsr = 0;
+static unsigned long wakeups = 0;           // WFI ended
+static unsigned long long sleepCycles = 0;  // Cycles in WFI
+
+static Host_Reg *regList = NULL;
+static Host_Model *modelList = NULL;
+static Host_Isr *isrList = NULL;
+
+static char line[128];
+static size_t lineLen = 0;
+
+static void Host_Finish(const char *reason, int status);
+
+//**************************************************************
+//  Registers
+//**************************************************************
+void Host_RegAdd(Host_Reg *reg) {
+    Host_Reg **p = &regList;
+    while (*p) p = &(*p)->next;     // Keep the order of declaration
+    reg->next = NULL;
+    *p = reg;
+}
+
+Host_Reg *Host_RegFind(const volatile void *addr) {
+    const volatile uint8 *a = addr;
+    Host_Reg *reg;
+    for (reg = regList; reg; reg = reg->next) {
+        const volatile uint8 *base = reg->addr;
+        if (a >= base && a < base + reg->size) return reg;
+    }
+    return NULL;
+}
+
+uint32 Host_RegRead(Host_Reg *reg) {
+    uint32 value;
+    Host_Enter();
+    accesses++;
+    Host_Advance(HOST_REG_COST(reg->size));
+    value = reg->read(reg);
+    reg->reads++;
+    reg->cycles += HOST_REG_COST(reg->size);
+    Host_Leave();
+    return value;
+}
+
+void Host_RegWrite(Host_Reg *reg, uint32 value) {
+    Host_Enter();
+    accesses++;
+    Host_Advance(HOST_REG_COST(reg->size));
+    reg->write(reg, value);
+    reg->writes++;
+    reg->cycles += HOST_REG_COST(reg->size);
+    Host_Leave();
+}
+
+// CY_GET_REGxx() and CY_SET_REGxx()
+uint32 Host_Read(const volatile void *addr, uint8 size) {
+    Host_Reg *reg = Host_RegFind(addr);
+    if (reg) return Host_RegRead(reg);
+    switch (size) {
+        case 1u: return *(const volatile uint8 *)addr;
+        case 2u: return *(const volatile uint16 *)addr;
+        default: return *(const volatile uint32 *)addr;
+    }
+}
+
+void Host_Write(volatile void *addr, uint8 size, uint32 value) {
+    Host_Reg *reg = Host_RegFind(addr);
+    if (reg) {
+        Host_RegWrite(reg, value);
+        return;
+    }
+    switch (size) {
+        case 1u: *(volatile uint8 *)addr = (uint8)value; break;
+        case 2u: *(volatile uint16 *)addr = (uint16)value; break;
+        default: *(volatile uint32 *)addr = value; break;
+    }
+}
+
+//**************************************************************
+//  Models
+//**************************************************************
+void Host_ModelAdd(Host_Model *model) {
+    Host_Model **p = &modelList;
+    while (*p) p = &(*p)->next;
+    model->next = NULL;
+    *p = model;
+}
+
+static uint8 Host_Active(void) {
+    Host_Model *model;
+    if (swUsed && cycles < swRelease) return 1u;    // Switch event to come
+    for (model = modelList; model; model = model->next) {
+        if (model->active && model->active(model)) return 1u;
+    }
+    return 0u;
+}
+
+//**************************************************************
+//  Interrupts
+//**************************************************************
+void Host_IntEnable(uint8 enable) {
+    Host_Enter();
+    intEnabled = enable;
+    Host_Leave();
+}
+
+uint8 Host_IntDisable(void) {
+    uint8 enabled = intEnabled;
+    intEnabled = 0u;
+    return enabled;
+}
+
+void Host_IsrStart(Host_Isr *isr, cyisraddress handler) {
+    Host_Isr *p;
+    for (p = isrList; p; p = p->next) {
+        if (p == isr) break;
+    }
+    if (!p) {
+        isr->next = isrList;
+        isrList = isr;
+    }
+    isr->handler = handler;
+    isr->enabled = 1u;
+}
+
+void Host_IsrStop(Host_Isr *isr) {
+    isr->enabled = 0u;
+}
+
+void Host_IsrEnable(Host_Isr *isr, uint8 enable) {
+    isr->enabled = enable;
+}
+
+void Host_IsrSetPending(Host_Isr *isr) {
+    isr->pending = 1u;
+}
+
+void Host_IsrClearPending(Host_Isr *isr) {
+    isr->pending = 0u;
+}
+
+// Pending whether the interrupts are masked or not
+static uint8 Host_IsrPending(void) {
+    Host_Isr *isr;
+    for (isr = isrList; isr; isr = isr->next) {
+        if (isr->pending && isr->enabled && isr->handler) return 1u;
+    }
+    return 0u;
+}
+
+static uint8 Host_IsrReady(void) {
+    if (!intEnabled || inIsr) return 0u;
+    return Host_IsrPending();
+}
+
+static void Host_IsrDispatch(void) {
+    Host_Isr *isr;
+    while (Host_IsrReady()) {
+        for (isr = isrList; isr; isr = isr->next) {
+            if (isr->pending && isr->enabled && isr->handler) {
+                isr->pending = 0u;
+                isr->count++;
+                inIsr = 1u;
+                depth++;
+                Host_Advance(HOST_COST_ISR);
+                depth--;
+                isr->handler();
+                inIsr = 0u;
+                break;
+            }
+        }
+    }
+}
+
+//**************************************************************
+//  Time
+//**************************************************************
+unsigned long long Host_Cycles(void) {
+    return cycles;
+}
+
+void Host_Advance(uint32 n) {
+    Host_Model *model;
+    while (n--) {
+        cycles++;
+        for (model = modelList; model; model = model->next) {
+            if (model->step) model->step(model);
+        }
+        if (cycles >= runCycles) {
+            Host_Finish("run limit", 0);
+        }
+    }
+}
+
+void Host_Enter(void) {
+    depth++;
+}
+
+void Host_Leave(void) {
+    if (--depth == 0) {
+        // An interrupt raised during the access is taken after it
+        Host_IsrDispatch();
+    }
+}
+
+uint8 Host_Switch(void) {
+    swUsed = 1u;
+    return (cycles >= swPress && cycles < swRelease) ? 0u : 1u;
+}
+
+// The CPU is spinning on a RAM flag.  Nothing but an interrupt
+// ends the loop, so run the clock up to the next one.
+static void Host_Idle(void) {
+    Host_Enter();
+    while (!Host_IsrReady()) {
+        if (!Host_Active()) {
+            Host_Finish("idle", 0);
+        }
+        Host_Advance(1u);
+    }
+    Host_Leave();
+}
+
+// WFI stops the CPU up to an interrupt pending, even a masked one
+void Host_Wfi(void) {
+    Host_Enter();
+    while (!Host_IsrPending()) {
+        if (!Host_Active()) {
+            Host_Finish("idle", 0);
+        }
+        Host_Advance(1u);
+        sleepCycles++;
+    }
+    wakeups++;
+    Host_Leave();
+}
+
+static void Host_Tick(int sig) {
+    static unsigned long lastAccesses = 0;
+    static uint8 resumed = 0u;
+    (void)sig;
+    if (depth > 0 || inIsr) return;
+    // A tick pending at the end of Host_Idle() comes before the
+    // firmware sees its interrupt, so give it one more tick.
+    if (accesses == lastAccesses && !resumed) {
+        Host_Idle();
+        resumed = 1u;
+    } else {
+        resumed = 0u;
+    }
+    lastAccesses = accesses;
+}
+
+static void Host_Timeout(int sig) {
+    (void)sig;
+    Host_Finish("timeout", 2);
+}
+
+//**************************************************************
+//  Console
+//**************************************************************
+void Host_ConsolePut(char c) {
+    putchar(c);
+    if (!trace) return;
+    if (c == '\n' || lineLen >= sizeof line - 1) {
+        line[lineLen] = '\0';
+        fprintf(stderr, "[%10llu] %s\n", cycles, line);
+        lineLen = 0;
+    } else if (c != '\r') {
+        line[lineLen++] = c;
+    }
+}
+
+//**************************************************************
+//  Report
+//**************************************************************
+static void Host_Finish(const char *reason, int status) {
+    Host_Reg *reg;
+    Host_Model *model;
+    Host_Isr *isr;
+
+    fflush(stdout);
+    fprintf(stderr, "\n==== host: %s at %llu cycles\n", reason, cycles);
+    fprintf(stderr, "%-24s %10s %10s %12s\n", "register", "reads", "writes", "cycles");
+    for (reg = regList; reg; reg = reg->next) {
+        if (reg->reads || reg->writes) {
+            fprintf(stderr, "%-24s %10lu %10lu %12llu\n",
+                reg->name, reg->reads, reg->writes, reg->cycles);
+        }
+    }
+    for (model = modelList; model; model = model->next) {
+        if (model->report) model->report(model);
+    }
+    for (isr = isrList; isr; isr = isr->next) {
+        fprintf(stderr, "%-24s %10lu interrupts\n", isr->name, isr->count);
+    }
+    if (wakeups) {
+        fprintf(stderr, "%-24s %10lu wakeups %10llu sleep cycles\n",
+            "CPU", wakeups, sleepCycles);
+    }
+    fflush(stderr);
+    _exit(status);
+}
+
+static unsigned long long Host_Env(const char *name, unsigned long long dflt) {
+    const char *s = getenv(name);
+    return (s && *s) ? strtoull(s, NULL, 0) : dflt;
+}
+
+__attribute__ ((constructor))
+static void Host_Init(void) {
+    struct sigaction sa;
+    struct itimerval tv;
+
+    // A TD holds a 32-bit address
+    if ((uintptr_t)&cycles > 0xFFFFFFFFu) {
+        fprintf(stderr, "host: static data above 4GB, link with -no-pie\n");
+        _exit(2);
+    }
+
+    runCycles = Host_Env("HOST_RUN_CYCLES", runCycles);
+    swPress = Host_Env("HOST_SW_PRESS", swPress);
+    swRelease = Host_Env("HOST_SW_RELEASE", swRelease);
+    trace = (int)Host_Env("HOST_TRACE", 0);
+
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = Host_Tick;
+    sigaction(SIGVTALRM, &sa, NULL);
+    tv.it_interval.tv_sec = 0;
+    tv.it_interval.tv_usec = 1000;
+    tv.it_value = tv.it_interval;
+    setitimer(ITIMER_VIRTUAL, &tv, NULL);
+
+    sa.sa_handler = Host_Timeout;
+    sigaction(SIGALRM, &sa, NULL);
+    alarm((unsigned)Host_Env("HOST_TIMEOUT", 30));
+}
+
+/* [] END OF FILE */
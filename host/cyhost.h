@@ -0,0 +1,131 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Host mock of the PSoC 5LP peripherals used by the test firmware.
+//
+// Time is counted in BUS_CLK cycles.  Every access to a mocked
+// register costs a fixed number of cycles, and the component
+// models are stepped one clock at a time while the time goes.
+// A loop spinning on a RAM flag is detected by a timer signal
+// and the time is advanced up to the next interrupt.
+
+#if !defined(CY_HOST_CYHOST_H)
+#define CY_HOST_CYHOST_H
+
+#include "cytypes.h"
+
+//**************************************************************
+//  Cycle costs
+//**************************************************************
+#if !defined(HOST_COST_REG)
+#define HOST_COST_REG       (3u)    // UDB register access per 16 bits
+#endif
+
+// The UDB spoke is 16 bits wide
+#define HOST_REG_COST(size) (HOST_COST_REG * (((size) + 1u) / 2u))
+#if !defined(HOST_COST_DMA_BURST)
+#define HOST_COST_DMA_BURST (6u)    // DMA arbitration per burst
+#endif
+#if !defined(HOST_COST_DMA_TD)
+#define HOST_COST_DMA_TD    (4u)    // DMA fetch of the next TD
+#endif
+#if !defined(HOST_COST_ISR)
+#define HOST_COST_ISR       (24u)   // Exception entry and return
+#endif
+#if !defined(HOST_COST_SRAM)
+#define HOST_COST_SRAM      (2u)    // DMA access to SRAM or flash
+#endif
+
+//**************************************************************
+//  Mocked register
+//**************************************************************
+typedef struct Host_Reg Host_Reg;
+struct Host_Reg {
+    const char  *name;
+    volatile void *addr;            // Address seen by the firmware
+    uint8       size;               // Width in bytes
+    uint32      (*read)(Host_Reg *reg);
+    void        (*write)(Host_Reg *reg, uint32 value);
+    void        *model;
+    // Statistics
+    unsigned long reads;
+    unsigned long writes;
+    unsigned long long cycles;
+    Host_Reg    *next;
+};
+
+extern void Host_RegAdd(Host_Reg *reg);
+extern Host_Reg *Host_RegFind(const volatile void *addr);
+extern uint32 Host_RegRead(Host_Reg *reg);
+extern void Host_RegWrite(Host_Reg *reg, uint32 value);
+
+//**************************************************************
+//  Component model stepped every clock
+//**************************************************************
+typedef struct Host_Model Host_Model;
+struct Host_Model {
+    const char  *name;
+    void        (*step)(Host_Model *model);
+    uint8       (*active)(Host_Model *model);   // Non-zero while working
+    void        (*report)(Host_Model *model);
+    void        *state;
+    Host_Model  *next;
+};
+
+extern void Host_ModelAdd(Host_Model *model);
+
+//**************************************************************
+//  Interrupt
+//**************************************************************
+typedef struct Host_Isr {
+    const char  *name;
+    cyisraddress handler;
+    uint8       enabled;
+    uint8       pending;
+    unsigned long count;
+    struct Host_Isr *next;
+} Host_Isr;
+
+extern void Host_IsrStart(Host_Isr *isr, cyisraddress handler);
+extern void Host_IsrStop(Host_Isr *isr);
+extern void Host_IsrEnable(Host_Isr *isr, uint8 enable);
+extern void Host_IsrSetPending(Host_Isr *isr);
+extern void Host_IsrClearPending(Host_Isr *isr);
+
+//**************************************************************
+//  DMA channel of a DMA component
+//**************************************************************
+typedef struct Host_DmaCh {
+    const char  *name;
+    uint8       (*drq)(void);       // Hardware request, NULL for none
+    Host_Isr    *nrq;               // Interrupt on TERMOUT0, or NULL
+} Host_DmaCh;
+
+extern uint8 Host_DmaInitialize(Host_DmaCh *ch,
+    uint8 burstCount, uint8 requestPerBurst);
+
+//**************************************************************
+//  Time
+//**************************************************************
+extern unsigned long long Host_Cycles(void);
+extern void Host_Advance(uint32 cycles);
+extern void Host_Enter(void);
+extern void Host_Leave(void);
+
+// Switch input, LOW while pushed
+extern uint8 Host_Switch(void);
+
+// Console output with optional cycle stamps
+extern void Host_ConsolePut(char c);
+
+#endif  // CY_HOST_CYHOST_H
+/* [] END OF FILE */
@@ -0,0 +1,424 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// DMA controller model
+//
+// The DMAC serves one channel at a time.
+// A burst starts when the channel sees a request and takes
+// HOST_COST_DMA_BURST plus the cost of every access.  The data
+// is moved at the end of the burst.  The hardware request is
+// taken as a level.  Bus contention with the CPU is not counted.
+
+#include "cyhost.h"
+#include "CyDmac.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    uint16      count;
+    uint8       next;
+    uint8       config;
+    uint32      src;
+    uint32      dst;
+    uint8       used;
+} Td;
+
+typedef struct {
+    Host_DmaCh  *inst;
+    uint8       used;
+    uint8       enabled;
+    uint8       burstCount;
+    uint8       requestPerBurst;
+    uint8       preserve;
+    uint8       initialTd;
+    uint8       td;             // Current TD
+    uint8       active;         // Chain active
+    uint8       inTd;           // TD started by a request
+    uint8       cpuReq;
+    Td          work;           // Working copy of the current TD
+    uint32      wait;           // Cycles left in the burst
+    uint16      burstBytes;
+    // Statistics
+    unsigned long bursts;
+    unsigned long bytes;
+    unsigned long tds;
+    unsigned long long idle;    // Cycles enabled without a request
+    unsigned long long blocked; // Cycles waiting for another channel
+} Ch;
+
+// TD address to a host pointer
+#define ADDR(a)     ((void *)(uintptr_t)(a))
+
+static Td tds[CY_DMA_NUMBEROF_TDS];
+static Ch chs[CY_DMA_NUMBEROF_CHANNELS];
+
+//**************************************************************
+//  Data movement
+//**************************************************************
+static uint32 Cost(uint32 addr, uint8 size) {
+    Host_Reg *reg = Host_RegFind(ADDR(addr));
+    return reg ? HOST_REG_COST(size) : HOST_COST_SRAM;
+}
+
+static uint32 Load(uint32 addr, uint8 size) {
+    Host_Reg *reg = Host_RegFind(ADDR(addr));
+    uint32 value = 0;
+    if (reg) {
+        reg->reads++;
+        reg->cycles += HOST_REG_COST(size);
+        return reg->read(reg);
+    }
+    memcpy(&value, ADDR(addr), size);
+    return value;
+}
+
+static void Store(uint32 addr, uint8 size, uint32 value) {
+    Host_Reg *reg = Host_RegFind(ADDR(addr));
+    if (reg) {
+        reg->writes++;
+        reg->cycles += HOST_REG_COST(size);
+        reg->write(reg, value);
+        return;
+    }
+    memcpy(ADDR(addr), &value, size);
+}
+
+// Access size: a register is accessed at its own width
+static uint8 Unit(Ch *ch) {
+    Host_Reg *reg = Host_RegFind(ADDR(ch->work.dst));
+    if (!reg) reg = Host_RegFind(ADDR(ch->work.src));
+    return reg ? reg->size : 1u;
+}
+
+static uint16 BurstBytes(Ch *ch) {
+    uint16 n = ch->burstCount ? ch->burstCount : 1u;
+    return (ch->work.count < n) ? ch->work.count : n;
+}
+
+static void Move(Ch *ch) {
+    uint16 n = ch->burstBytes;
+    uint8 unit = Unit(ch);
+    while (n > 0) {
+        uint8 size = (n < unit) ? (uint8)n : unit;
+        Store(ch->work.dst, size, Load(ch->work.src, size));
+        if (ch->work.config & CY_DMA_TD_INC_SRC_ADR) ch->work.src += size;
+        if (ch->work.config & CY_DMA_TD_INC_DST_ADR) ch->work.dst += size;
+        n -= size;
+    }
+    ch->work.count -= ch->burstBytes;
+    ch->bursts++;
+    ch->bytes += ch->burstBytes;
+}
+
+static uint32 BurstCost(Ch *ch) {
+    uint8 unit = Unit(ch);
+    uint32 accesses = (ch->burstBytes + unit - 1u) / unit;
+    return HOST_COST_DMA_BURST
+        + accesses * (Cost(ch->work.src, unit) + Cost(ch->work.dst, unit));
+}
+
+//**************************************************************
+//  Channel sequencing
+//**************************************************************
+static void LoadTd(Ch *ch, uint8 td) {
+    ch->td = td;
+    ch->work = tds[td];
+    ch->inTd = 0u;
+}
+
+static void EndTd(Ch *ch) {
+    Td *td = &tds[ch->td];
+    uint8 next = td->next;
+    uint8 auto_next = (td->config & CY_DMA_TD_AUTO_EXEC_NEXT) ? 1u : 0u;
+
+    ch->tds++;
+    if (!ch->preserve) {
+        td->count = 0u;
+        td->src = ch->work.src;
+        td->dst = ch->work.dst;
+    }
+    if ((td->config & CY_DMA_TD_TERMOUT0_EN) && ch->inst && ch->inst->nrq) {
+        Host_IsrSetPending(ch->inst->nrq);
+    }
+    if (next == CY_DMA_DISABLE_TD) {
+        ch->active = 0u;
+        ch->enabled = 0u;
+    } else if (next == CY_DMA_END_CHAIN_TD) {
+        ch->active = 0u;
+    } else {
+        LoadTd(ch, next);
+        ch->inTd = auto_next;
+        ch->wait = HOST_COST_DMA_TD;
+    }
+}
+
+// One burst or TD fetch at a time, channels taken in turn
+static void Step(Host_Model *model) {
+    static int engine = -1;         // Channel owning the DMAC
+    static uint8 turn = 0u;
+    uint8 k;
+    (void)model;
+    if (engine >= 0) {
+        Ch *ch = &chs[engine];
+        if (!ch->enabled || !ch->active || ch->wait == 0u) {
+            ch->wait = 0u;
+            ch->burstBytes = 0u;
+            engine = -1;
+        } else if (--ch->wait == 0u) {
+            if (ch->burstBytes) {
+                Move(ch);
+                ch->burstBytes = 0u;
+                if (ch->work.count == 0u) EndTd(ch);
+            }
+            if (ch->wait == 0u) engine = -1;
+        }
+    }
+    for (k = 0; k < CY_DMA_NUMBEROF_CHANNELS; k++) {
+        uint8 i = (turn + k) % CY_DMA_NUMBEROF_CHANNELS;
+        Ch *ch = &chs[i];
+        uint8 req;
+        if (!ch->enabled || !ch->active || (int)i == engine) continue;
+        req = ch->cpuReq || (ch->inst && ch->inst->drq && ch->inst->drq());
+        if (!req && !(ch->inTd && !ch->requestPerBurst)) {
+            ch->idle++;
+            continue;
+        }
+        if (engine >= 0) {
+            ch->blocked++;
+            continue;
+        }
+        ch->cpuReq = 0u;
+        ch->inTd = 1u;
+        engine = i;
+        turn = i + 1u;
+        if (ch->work.count == 0u) {
+            EndTd(ch);
+            if (ch->wait == 0u) engine = -1;
+            continue;
+        }
+        ch->burstBytes = BurstBytes(ch);
+        ch->wait = BurstCost(ch);
+    }
+}
+
+static uint8 Active(Host_Model *model) {
+    uint8 i;
+    (void)model;
+    for (i = 0; i < CY_DMA_NUMBEROF_CHANNELS; i++) {
+        if (chs[i].enabled && chs[i].active) return 1u;
+    }
+    return 0u;
+}
+
+static void Report(Host_Model *model) {
+    uint8 i;
+    (void)model;
+    for (i = 0; i < CY_DMA_NUMBEROF_CHANNELS; i++) {
+        Ch *ch = &chs[i];
+        if (!ch->used) continue;
+        fprintf(stderr, "%-24s %10lu bursts %10lu bytes %6lu TDs %10llu waiting %10llu blocked\n",
+            ch->inst ? ch->inst->name : "DMA", ch->bursts, ch->bytes, ch->tds, ch->idle, ch->blocked);
+    }
+}
+
+static Host_Model dmac = { "DMAC", Step, Active, Report, NULL, NULL };
+
+__attribute__ ((constructor))
+static void Init(void) {
+    Host_ModelAdd(&dmac);
+}
+
+//**************************************************************
+//  Channel API
+//**************************************************************
+uint8 Host_DmaInitialize(Host_DmaCh *inst, uint8 burstCount, uint8 requestPerBurst) {
+    uint8 handle = CyDmaChAlloc();
+    if (handle != CY_DMA_INVALID_CHANNEL) {
+        chs[handle].inst = inst;
+        CyDmaChSetConfiguration(handle, burstCount, requestPerBurst, 0u, 0u, 0u);
+    }
+    return handle;
+}
+
+uint8 CyDmaChAlloc(void) {
+    uint8 i;
+    for (i = 0; i < CY_DMA_NUMBEROF_CHANNELS; i++) {
+        if (!chs[i].used) {
+            memset(&chs[i], 0, sizeof chs[i]);
+            chs[i].used = 1u;
+            return i;
+        }
+    }
+    return CY_DMA_INVALID_CHANNEL;
+}
+
+cystatus CyDmaChFree(uint8 chHandle) {
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    chs[chHandle].used = 0u;
+    chs[chHandle].enabled = 0u;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChEnable(uint8 chHandle, uint8 preserveTds) {
+    Ch *ch;
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    ch = &chs[chHandle];
+    Host_Enter();
+    Host_Advance(HOST_COST_REG);
+    ch->preserve = preserveTds;
+    LoadTd(ch, ch->initialTd);
+    ch->wait = 0u;
+    ch->burstBytes = 0u;
+    ch->active = 1u;
+    ch->enabled = 1u;
+    Host_Leave();
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChDisable(uint8 chHandle) {
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    Host_Enter();
+    Host_Advance(HOST_COST_REG);
+    chs[chHandle].enabled = 0u;
+    chs[chHandle].active = 0u;
+    Host_Leave();
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaClearPendingDrq(uint8 chHandle) {
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    chs[chHandle].cpuReq = 0u;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChPriority(uint8 chHandle, uint8 priority) {
+    (void)priority;
+    return (chHandle < CY_DMA_NUMBEROF_CHANNELS) ? CYRET_SUCCESS : CYRET_BAD_PARAM;
+}
+
+cystatus CyDmaChSetInitialTd(uint8 chHandle, uint8 startTd) {
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    chs[chHandle].initialTd = startTd;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChSetRequest(uint8 chHandle, uint8 request) {
+    Ch *ch;
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    ch = &chs[chHandle];
+    Host_Enter();
+    Host_Advance(HOST_COST_REG);
+    if (request & CY_DMA_CPU_REQ) ch->cpuReq = 1u;
+    if (request & CY_DMA_CPU_TERM_TD) ch->work.count = 0u;
+    if (request & CY_DMA_CPU_TERM_CHAIN) ch->active = 0u;
+    Host_Leave();
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChGetRequest(uint8 chHandle) {
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    return chs[chHandle].cpuReq ? CY_DMA_CPU_REQ : 0u;
+}
+
+cystatus CyDmaChStatus(uint8 chHandle, uint8 *currentTd, uint8 *state) {
+    Ch *ch;
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    ch = &chs[chHandle];
+    Host_Enter();
+    Host_Advance(HOST_COST_REG);
+    if (currentTd) *currentTd = ch->td;
+    if (state) {
+        *state = 0u;
+        if (ch->enabled && ch->active) *state |= CY_DMA_STATUS_CHAIN_ACTIVE;
+        if (ch->enabled && ch->active && ch->inTd) *state |= CY_DMA_STATUS_TD_ACTIVE;
+    }
+    Host_Leave();
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaChSetConfiguration(uint8 chHandle, uint8 burstCount,
+        uint8 requestPerBurst, uint8 tdDone0, uint8 tdDone1, uint8 tdStop) {
+    (void)tdDone0; (void)tdDone1; (void)tdStop;
+    if (chHandle >= CY_DMA_NUMBEROF_CHANNELS) return CYRET_BAD_PARAM;
+    chs[chHandle].burstCount = burstCount;
+    chs[chHandle].requestPerBurst = requestPerBurst;
+    return CYRET_SUCCESS;
+}
+
+// The upper addresses are not used on the host.
+cystatus CyDmaChSetExtendedAddress(uint8 chHandle, uint16 source, uint16 destination) {
+    (void)source; (void)destination;
+    return (chHandle < CY_DMA_NUMBEROF_CHANNELS) ? CYRET_SUCCESS : CYRET_BAD_PARAM;
+}
+
+//**************************************************************
+//  TD API
+//**************************************************************
+uint8 CyDmaTdAllocate(void) {
+    uint8 i;
+    for (i = 0; i < CY_DMA_NUMBEROF_TDS; i++) {
+        if (!tds[i].used) {
+            memset(&tds[i], 0, sizeof tds[i]);
+            tds[i].used = 1u;
+            tds[i].next = CY_DMA_END_CHAIN_TD;
+            return i;
+        }
+    }
+    return CY_DMA_INVALID_TD;
+}
+
+void CyDmaTdFree(uint8 tdHandle) {
+    if (tdHandle < CY_DMA_NUMBEROF_TDS) tds[tdHandle].used = 0u;
+}
+
+uint8 CyDmaTdFreeCount(void) {
+    uint8 i, n = 0u;
+    for (i = 0; i < CY_DMA_NUMBEROF_TDS; i++) {
+        if (!tds[i].used) n++;
+    }
+    return n;
+}
+
+cystatus CyDmaTdSetConfiguration(uint8 tdHandle, uint16 transferCount,
+        uint8 nextTd, uint8 configuration) {
+    if (tdHandle >= CY_DMA_NUMBEROF_TDS || transferCount > 4095u) return CYRET_BAD_PARAM;
+    tds[tdHandle].count = transferCount;
+    tds[tdHandle].next = nextTd;
+    tds[tdHandle].config = configuration;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaTdGetConfiguration(uint8 tdHandle, uint16 *transferCount,
+        uint8 *nextTd, uint8 *configuration) {
+    if (tdHandle >= CY_DMA_NUMBEROF_TDS) return CYRET_BAD_PARAM;
+    if (transferCount) *transferCount = tds[tdHandle].count;
+    if (nextTd) *nextTd = tds[tdHandle].next;
+    if (configuration) *configuration = tds[tdHandle].config;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaTdSetAddress(uint8 tdHandle, uint32 source, uint32 destination) {
+    if (tdHandle >= CY_DMA_NUMBEROF_TDS) return CYRET_BAD_PARAM;
+    tds[tdHandle].src = source;
+    tds[tdHandle].dst = destination;
+    return CYRET_SUCCESS;
+}
+
+cystatus CyDmaTdGetAddress(uint8 tdHandle, uint32 *source, uint32 *destination) {
+    if (tdHandle >= CY_DMA_NUMBEROF_TDS) return CYRET_BAD_PARAM;
+    if (source) *source = tds[tdHandle].src;
+    if (destination) *destination = tds[tdHandle].dst;
+    return CYRET_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,725 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "cyhost_models.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// "INSTANCE.REGISTER"
+static const char *Name(const char *inst, const char *reg) {
+    size_t n = strlen(inst) + strlen(reg) + 2u;
+    char *s = malloc(n);
+    if (!s) abort();
+    snprintf(s, n, "%s.%s", inst, reg);
+    return s;
+}
+
+static uint32 Mask(uint8 width) {
+    return (width >= 32u) ? 0xFFFFFFFFul : ((1ul << width) - 1ul);
+}
+
+//**************************************************************
+//  Plain storage register
+//**************************************************************
+static uint32 PlainRead(Host_Reg *reg) {
+    switch (reg->size) {
+        case 1u: return *(volatile uint8 *)reg->addr;
+        case 2u: return *(volatile uint16 *)reg->addr;
+        default: return *(volatile uint32 *)reg->addr & 0xFFFFFFFFul;
+    }
+}
+
+static void PlainWrite(Host_Reg *reg, uint32 value) {
+    switch (reg->size) {
+        case 1u: *(volatile uint8 *)reg->addr = (uint8)value; break;
+        case 2u: *(volatile uint16 *)reg->addr = (uint16)value; break;
+        default: *(volatile uint32 *)reg->addr = value & 0xFFFFFFFFul; break;
+    }
+}
+
+void Host_PlainInit(Host_Reg *reg, const char *name, volatile void *addr, uint8 size) {
+    memset(reg, 0, sizeof *reg);
+    reg->name = name;
+    reg->addr = addr;
+    reg->size = size;
+    reg->read = PlainRead;
+    reg->write = PlainWrite;
+    Host_RegAdd(reg);
+}
+
+//**************************************************************
+//  Accumulator8/16/32
+//**************************************************************
+#define ACC_IDLE    (0u)
+#define ACC_GET     (1u)
+#define ACC_ADD     (2u)
+#define ACC_COPY    (3u)
+#define ACC_SHIFT   (4u)
+#define ACC_ROUND   (5u)
+#define ACC_DONE    (6u)
+#define ACC_SIGN    (7u)
+
+static void AccInputWrite(Host_Reg *reg, uint32 value) {
+    Host_Acc *acc = reg->model;
+    if (acc->count < HOST_FIFO_DEPTH) {
+        acc->fifo[(acc->head + acc->count) % HOST_FIFO_DEPTH] = value & Mask(acc->inputWidth);
+        acc->count++;
+    } else {
+        acc->lost++;
+    }
+}
+
+static uint32 AccInputRead(Host_Reg *reg) {
+    (void)reg;
+    return 0u;
+}
+
+static uint32 AccA0Read(Host_Reg *reg) {
+    Host_Acc *acc = reg->model;
+    return acc->a0;
+}
+
+// Compare 1, A0 > D1, held LOW with InputSigned
+static void AccCompare(Host_Acc *acc) {
+    uint8 over = (!acc->inputSigned && acc->a0 > acc->d1) ? 1u : 0u;
+    if (over && !acc->over && acc->overIsr) {
+        Host_IsrSetPending(acc->overIsr);
+    }
+    acc->over = over;
+}
+
+static void AccA0Write(Host_Reg *reg, uint32 value) {
+    Host_Acc *acc = reg->model;
+    acc->a0 = value & Mask(acc->width);
+    AccCompare(acc);
+}
+
+static uint32 AccA1Read(Host_Reg *reg) {
+    Host_Acc *acc = reg->model;
+    return acc->a1;
+}
+
+static void AccA1Write(Host_Reg *reg, uint32 value) {
+    Host_Acc *acc = reg->model;
+    acc->a1 = value & Mask(acc->width);
+}
+
+// F1 is in the output mode, a read pops it
+static uint32 AccF1Read(Host_Reg *reg) {
+    Host_Acc *acc = reg->model;
+    uint32 value = acc->results[acc->resultHead];
+    if (acc->resultCount) {
+        acc->resultHead = (acc->resultHead + 1u) % HOST_FIFO_DEPTH;
+        acc->resultCount--;
+    }
+    return value;
+}
+
+static void AccF1Write(Host_Reg *reg, uint32 value) {
+    (void)reg;
+    (void)value;
+}
+
+static uint32 AccD1Read(Host_Reg *reg) {
+    Host_Acc *acc = reg->model;
+    return acc->d1;
+}
+
+static void AccD1Write(Host_Reg *reg, uint32 value) {
+    Host_Acc *acc = reg->model;
+    acc->d1 = value & Mask(acc->width);
+    AccCompare(acc);
+}
+
+// After the mean, if any
+static uint8 AccEnd(Host_Acc *acc) {
+    return acc->resultFifo ? ACC_DONE : ACC_IDLE;
+}
+
+// Drained: ADD -> IDLE, or ADD -> COPY -> SHIFT ... -> ROUND -> SHIFT -> IDLE
+// with DONE before IDLE for the result FIFO
+static uint8 AccDrained(Host_Acc *acc) {
+    return acc->meanShift ? ACC_COPY : AccEnd(acc);
+}
+
+// ROUTE_SI of the mean: the MSB of A0 back in the first SHIFT,
+// the sign or 0 in the next ones, and the carry of ROUND in the last
+static uint8 AccRouteSi(const Host_Acc *acc) {
+    uint8 sign = acc->inputSigned ? acc->meanSign : 0u;
+    if (acc->shifts == acc->meanShift) {
+        return acc->meanSign;
+    }
+    return acc->shifts ? sign : (uint8)(sign ^ acc->meanCarry);
+}
+
+// IDLE -> GET -> ADD -> GET ... -> IDLE, one clock each
+static void AccStep(Host_Model *model) {
+    Host_Acc *acc = model->state;
+    uint8 next = ACC_IDLE;
+    if (++acc->phase < acc->div) return;
+    acc->phase = 0u;
+    switch (acc->state) {
+        case ACC_GET:
+            acc->d0 = acc->fifo[acc->head];
+            acc->head = (acc->head + 1u) % HOST_FIFO_DEPTH;
+            acc->count--;
+            next = ACC_ADD;
+            if (acc->inputSigned && acc->inputWidth < acc->width) {
+                next = ACC_SIGN;
+            }
+            break;
+        case ACC_SIGN:
+            // Sign extension into the upper slices
+            if (acc->d0 >> (acc->inputWidth - 1u)) {
+                acc->d0 |= Mask(acc->width) & ~Mask(acc->inputWidth);
+            }
+            next = ACC_ADD;
+            break;
+        case ACC_ADD:
+            acc->a0 = (acc->a0 + acc->d0) & Mask(acc->width);
+            acc->items++;
+            AccCompare(acc);
+            next = acc->count ? ACC_GET : AccDrained(acc);
+            break;
+        case ACC_COPY:
+            // A0 shifted left, the MSB out to SO
+            acc->meanSign = (uint8)(acc->a0 >> (acc->width - 1u)) & 1u;
+            acc->a1 = (acc->a0 << 1) & Mask(acc->width);
+            acc->shifts = acc->meanShift;
+            next = ACC_SHIFT;
+            break;
+        case ACC_SHIFT:
+            acc->a1 = (acc->a1 >> 1) | ((uint32)AccRouteSi(acc) << (acc->width - 1u));
+            if (acc->shifts == 0u) {
+                next = AccEnd(acc);
+            } else {
+                next = (--acc->shifts) ? ACC_SHIFT : ACC_ROUND;
+            }
+            break;
+        case ACC_ROUND: {
+            unsigned long long sum = (unsigned long long)acc->a1 + 1u;
+            acc->meanCarry = (uint8)(sum >> acc->width) & 1u;
+            acc->a1 = (uint32)sum & Mask(acc->width);
+            next = ACC_SHIFT;
+            break;
+        }
+        case ACC_DONE:
+            if (acc->resultCount < HOST_FIFO_DEPTH) {
+                acc->results[(acc->resultHead + acc->resultCount) % HOST_FIFO_DEPTH] = acc->a0;
+                acc->resultCount++;
+            }
+            if (acc->done) {
+                acc->done(acc->doneContext);
+            }
+            next = ACC_IDLE;
+            break;
+        default:
+            next = acc->count ? ACC_GET : ACC_IDLE;
+            break;
+    }
+    if (acc->state != ACC_IDLE) {
+        acc->busyCycles += acc->div;
+        if (next == ACC_IDLE && acc->ready) {
+            Host_IsrSetPending(acc->ready);
+        }
+    }
+    acc->state = next;
+}
+
+static uint8 AccActive(Host_Model *model) {
+    Host_Acc *acc = model->state;
+    return (acc->state != ACC_IDLE || acc->count) ? 1u : 0u;
+}
+
+static void AccReport(Host_Model *model) {
+    Host_Acc *acc = model->state;
+    fprintf(stderr, "%-24s %10lu items %10lu lost %10llu busy cycles\n",
+        model->name, acc->items, acc->lost, acc->busyCycles);
+}
+
+void Host_AccInit(Host_Acc *acc, const char *name, uint8 width,
+        uint32 div, Host_Isr *ready) {
+    memset(acc, 0, sizeof *acc);
+    acc->width = width;
+    acc->inputWidth = width;
+    acc->d1 = Mask(width);      // D1 is all ones after reset
+    acc->div = div ? div : 1u;
+    acc->ready = ready;
+    Host_PlainInit(&acc->input, Name(name, "INPUT"), &acc->inputCell, width / 8u);
+    acc->input.read = AccInputRead;
+    acc->input.write = AccInputWrite;
+    acc->input.model = acc;
+    Host_PlainInit(&acc->accumulator, Name(name, "ACCUMULATOR"), &acc->accumulatorCell, width / 8u);
+    acc->accumulator.read = AccA0Read;
+    acc->accumulator.write = AccA0Write;
+    acc->accumulator.model = acc;
+    Host_PlainInit(&acc->mean, Name(name, "MEAN"), &acc->meanCell, width / 8u);
+    acc->mean.read = AccA1Read;
+    acc->mean.write = AccA1Write;
+    acc->mean.model = acc;
+    Host_PlainInit(&acc->result, Name(name, "RESULT"), &acc->resultCell, width / 8u);
+    acc->result.read = AccF1Read;
+    acc->result.write = AccF1Write;
+    acc->result.model = acc;
+    Host_PlainInit(&acc->threshold, Name(name, "THRESHOLD"), &acc->thresholdCell, width / 8u);
+    acc->threshold.read = AccD1Read;
+    acc->threshold.write = AccD1Write;
+    acc->threshold.model = acc;
+    acc->model.name = name;
+    acc->model.step = AccStep;
+    acc->model.active = AccActive;
+    acc->model.report = AccReport;
+    acc->model.state = acc;
+    Host_ModelAdd(&acc->model);
+}
+
+// MeanShift parameter, 0 disables the mean
+void Host_AccMeanShift(Host_Acc *acc, uint8 shift) {
+    acc->meanShift = shift;
+}
+
+// ResultFifo parameter with the DONE output
+void Host_AccResultFifo(Host_Acc *acc,
+        void (*done)(void *context), void *context) {
+    acc->resultFifo = 1u;
+    acc->done = done;
+    acc->doneContext = context;
+}
+
+// Narrow INPUT of Accumulator32, 8 or 16 bits
+void Host_AccInput(Host_Acc *acc, uint8 width, uint8 sign) {
+    acc->inputWidth = width;
+    acc->inputSigned = sign;
+    acc->input.size = width / 8u;
+}
+
+// Interrupt on OVER_THRESHOLD
+void Host_AccOverThreshold(Host_Acc *acc, Host_Isr *isr) {
+    acc->overIsr = isr;
+}
+
+uint8 Host_AccDreq(const Host_Acc *acc) {
+    return (acc->count < HOST_FIFO_DEPTH) ? 1u : 0u;
+}
+
+uint8 Host_AccBusy(const Host_Acc *acc) {
+    return (acc->state != ACC_IDLE) ? 1u : 0u;
+}
+
+// The result FIFO is not empty
+uint8 Host_AccResultReady(const Host_Acc *acc) {
+    return acc->resultCount ? 1u : 0u;
+}
+
+//**************************************************************
+//  NtanTimestamp on BUS_CLK
+//**************************************************************
+static uint32 TimestampRead(Host_Reg *reg) {
+    Host_Timestamp *ts = reg->model;
+    uint32 value = ts->fifo[ts->head];
+    if (ts->n) {
+        ts->head = (ts->head + 1u) % HOST_FIFO_DEPTH;
+        ts->n--;
+    }
+    return value;
+}
+
+static void TimestampWrite(Host_Reg *reg, uint32 value) {
+    (void)reg;
+    (void)value;
+}
+
+static void TimestampStep(Host_Model *model) {
+    Host_Timestamp *ts = model->state;
+    ts->count = (ts->count + 1u) & Mask(ts->width);
+}
+
+static void TimestampReport(Host_Model *model) {
+    Host_Timestamp *ts = model->state;
+    fprintf(stderr, "%-24s %10lu captures %10lu lost\n",
+        model->name, ts->captures, ts->lost);
+}
+
+void Host_TimestampInit(Host_Timestamp *ts, const char *name, uint8 width) {
+    memset(ts, 0, sizeof *ts);
+    ts->width = width;
+    Host_PlainInit(&ts->timestamp, Name(name, "TIMESTAMP"), &ts->timestampCell, width / 8u);
+    ts->timestamp.read = TimestampRead;
+    ts->timestamp.write = TimestampWrite;
+    ts->timestamp.model = ts;
+    ts->model.name = name;
+    ts->model.step = TimestampStep;
+    ts->model.report = TimestampReport;
+    ts->model.state = ts;
+    Host_ModelAdd(&ts->model);
+}
+
+// Rising edge of CAPTURE
+void Host_TimestampCapture(void *context) {
+    Host_Timestamp *ts = context;
+    if (ts->n < HOST_FIFO_DEPTH) {
+        ts->fifo[(ts->head + ts->n) % HOST_FIFO_DEPTH] = ts->count;
+        ts->n++;
+        ts->captures++;
+    } else {
+        ts->lost++;
+    }
+}
+
+uint8 Host_TimestampReady(const Host_Timestamp *ts) {
+    return ts->n ? 1u : 0u;
+}
+
+uint32 Host_TimestampCount(const Host_Timestamp *ts) {
+    return ts->count;
+}
+
+//**************************************************************
+//  NtanUartTx, 8N1
+//**************************************************************
+#define TX_IDLE     (0u)
+#define TX_DATA     (1u)
+#define TX_STOP     (2u)
+
+static void UartTxInputWrite(Host_Reg *reg, uint32 value) {
+    Host_UartTx *tx = reg->model;
+    if (tx->count < HOST_FIFO_DEPTH) {
+        tx->fifo[(tx->head + tx->count) % HOST_FIFO_DEPTH] = (uint8)value;
+        tx->count++;
+    } else {
+        tx->lost++;
+    }
+}
+
+static uint32 UartTxInputRead(Host_Reg *reg) {
+    (void)reg;
+    return 0u;
+}
+
+static void UartTxStart(Host_UartTx *tx) {
+    tx->shift = tx->fifo[tx->head];
+    tx->data = tx->shift;
+    tx->head = (tx->head + 1u) % HOST_FIFO_DEPTH;
+    tx->count--;
+    tx->nbit = 0u;
+    tx->tx = 0u;                // START bit
+    tx->state = TX_DATA;
+    tx->started = 1u;
+}
+
+static void UartTxStep(Host_Model *model) {
+    Host_UartTx *tx = model->state;
+    if (++tx->phase < tx->div) return;
+    tx->phase = 0u;
+    switch (tx->state) {
+        case TX_DATA:
+            tx->tx = tx->shift & 1u;
+            tx->shift >>= 1;
+            if (++tx->nbit == 8u) tx->state = TX_STOP;
+            break;
+        case TX_STOP:
+            tx->tx = 1u;
+            tx->chars++;
+            if (tx->console) Host_ConsolePut((char)tx->data);
+            tx->state = TX_IDLE;
+            break;
+        default:
+            if (tx->count) {
+                UartTxStart(tx);
+            } else {
+                tx->tx = 1u;
+                if (tx->started) tx->gaps++;
+            }
+            break;
+    }
+}
+
+static uint8 UartTxActive(Host_Model *model) {
+    Host_UartTx *tx = model->state;
+    return (tx->state != TX_IDLE || tx->count) ? 1u : 0u;
+}
+
+static void UartTxReport(Host_Model *model) {
+    Host_UartTx *tx = model->state;
+    fprintf(stderr, "%-24s %10lu chars %10lu lost %10lu idle bits\n",
+        model->name, tx->chars, tx->lost, tx->gaps);
+}
+
+void Host_UartTxInit(Host_UartTx *tx, const char *name, uint32 div) {
+    memset(tx, 0, sizeof *tx);
+    tx->div = div ? div : 1u;
+    tx->tx = 1u;
+    Host_PlainInit(&tx->input, Name(name, "INPUT"), &tx->inputCell, 1u);
+    tx->input.read = UartTxInputRead;
+    tx->input.write = UartTxInputWrite;
+    tx->input.model = tx;
+    tx->model.name = name;
+    tx->model.step = UartTxStep;
+    tx->model.active = UartTxActive;
+    tx->model.report = UartTxReport;
+    tx->model.state = tx;
+    Host_ModelAdd(&tx->model);
+}
+
+// The characters are copied to stdout as they are sent
+void Host_UartTxConsole(Host_UartTx *tx) {
+    tx->console = 1u;
+}
+
+uint8 Host_UartTxDreq(const Host_UartTx *tx) {
+    return (tx->count < HOST_FIFO_DEPTH) ? 1u : 0u;
+}
+
+//**************************************************************
+//  NtanHexFormatter on BUS_CLK
+//**************************************************************
+// Terminator parameter
+#define FMT_TERM_NONE   (0u)
+#define FMT_TERM_CRLF   (1u)
+#define FMT_TERM_LF     (2u)
+#define FMT_TERM_CR     (3u)
+
+// Parts of a line: 2 prefix characters, the digits, CR and LF
+#define FMT_PREFIX1     (1u)
+#define FMT_DIGIT0      (2u)
+
+static uint8 HexFmtDigits(const Host_HexFmt *fmt) {
+    if (!fmt->decimal) return fmt->width / 4u;
+    return (fmt->width == 32u) ? 10u : (fmt->width == 16u) ? 5u : 3u;
+}
+
+// Decimal digit of a word, counted from the LSB
+static uint8 HexFmtDecimal(uint32 word, uint8 digit) {
+    while (digit--) word /= 10u;
+    return (uint8)(word % 10u);
+}
+
+// Character of a part, 0 is not pushed
+static uint8 HexFmtChar(const Host_HexFmt *fmt, uint8 part) {
+    uint8 digits = HexFmtDigits(fmt);
+    if (part < FMT_DIGIT0) {
+        return fmt->prefixCell[part];
+    }
+    if (part < FMT_DIGIT0 + digits && fmt->decimal) {
+        return (uint8)('0' + HexFmtDecimal(fmt->word, digits - 1u - (part - FMT_DIGIT0)));
+    }
+    if (part < FMT_DIGIT0 + digits) {
+        uint8 nibble = (fmt->word >> (4u * (digits - 1u - (part - FMT_DIGIT0)))) & 0xFu;
+        return (nibble < 10u) ? (uint8)('0' + nibble) : (uint8)('A' + nibble - 10u);
+    }
+    if (part == FMT_DIGIT0 + digits && fmt->terminator != FMT_TERM_LF) {
+        return '\r';
+    }
+    return '\n';
+}
+
+// Clocks of a part up to its push, as counted in the state machine
+//   prefix   8 shifts, PUSH
+//   digit    4 shifts, ASCII, PUSH and a LOAD before the first one
+//   decimal  7 clocks a bit but 1 for the first in CONV after the
+//            LOAD, and 4 more shifts for the first digit of 8 and
+//            16 bits
+//   CR       LF, 3 INCs, PUSH
+//   LF       LF, PUSH
+static uint32 HexFmtClocks(const Host_HexFmt *fmt, uint8 part) {
+    uint8 digits = HexFmtDigits(fmt);
+    if (part < FMT_DIGIT0) return 9u;
+    if (part == FMT_DIGIT0 && fmt->decimal) {
+        return 7u + (7u * fmt->width - 6u) + ((fmt->width != 32u) ? 4u : 0u);
+    }
+    if (part == FMT_DIGIT0) return 7u;
+    if (part < FMT_DIGIT0 + digits) return 6u;
+    return (HexFmtChar(fmt, part) == '\r') ? 5u : 2u;
+}
+
+static void HexFmtInputWrite(Host_Reg *reg, uint32 value) {
+    Host_HexFmt *fmt = reg->model;
+    if (fmt->count < HOST_FIFO_DEPTH) {
+        fmt->fifo[(fmt->head + fmt->count) % HOST_FIFO_DEPTH] = value & Mask(fmt->width);
+        fmt->count++;
+    } else {
+        fmt->lost++;
+    }
+}
+
+static uint32 HexFmtInputRead(Host_Reg *reg) {
+    (void)reg;
+    return 0u;
+}
+
+static uint32 HexFmtOutputRead(Host_Reg *reg) {
+    Host_HexFmt *fmt = reg->model;
+    uint8 value = fmt->out[fmt->outHead];
+    if (fmt->outCount) {
+        fmt->outHead = (fmt->outHead + 1u) % HOST_FIFO_DEPTH;
+        fmt->outCount--;
+    }
+    return value;
+}
+
+static void HexFmtOutputWrite(Host_Reg *reg, uint32 value) {
+    (void)reg;
+    (void)value;
+}
+
+static void HexFmtStep(Host_Model *model) {
+    Host_HexFmt *fmt = model->state;
+    uint8 c;
+    if (!fmt->busy) {
+        // IDLE waits for a word, the prefix stays in F0
+        if (fmt->count) {
+            fmt->busy = 1u;
+            fmt->part = 0u;
+            fmt->wait = HexFmtClocks(fmt, 0u);
+        }
+        return;
+    }
+    if (--fmt->wait) return;
+    // PUSH
+    if (fmt->outCount >= HOST_FIFO_DEPTH) {
+        fmt->wait = 1u;
+        fmt->stalls++;
+        return;
+    }
+    c = HexFmtChar(fmt, fmt->part);
+    if (c) {
+        fmt->out[(fmt->outHead + fmt->outCount) % HOST_FIFO_DEPTH] = c;
+        fmt->outCount++;
+        fmt->chars++;
+    }
+    if (++fmt->part >= fmt->length) {
+        fmt->busy = 0u;
+        fmt->words++;
+        return;
+    }
+    if (fmt->part == FMT_DIGIT0) {
+        // LOAD
+        fmt->word = fmt->fifo[fmt->head];
+        fmt->head = (fmt->head + 1u) % HOST_FIFO_DEPTH;
+        fmt->count--;
+    }
+    fmt->wait = HexFmtClocks(fmt, fmt->part);
+}
+
+static uint8 HexFmtActive(Host_Model *model) {
+    Host_HexFmt *fmt = model->state;
+    return (fmt->busy || fmt->count) ? 1u : 0u;
+}
+
+static void HexFmtReport(Host_Model *model) {
+    Host_HexFmt *fmt = model->state;
+    fprintf(stderr, "%-24s %10lu words %10lu chars %10lu lost %10llu stalls\n",
+        model->name, fmt->words, fmt->chars, fmt->lost, fmt->stalls);
+}
+
+void Host_HexFmtInit(Host_HexFmt *fmt, const char *name, uint8 width,
+        uint8 terminator, uint8 decimal) {
+    static const char *const prefixes[2] = { "PREFIX0", "PREFIX1" };
+    uint8 i;
+    memset(fmt, 0, sizeof *fmt);
+    fmt->width = width;
+    fmt->terminator = terminator;
+    fmt->decimal = decimal;
+    fmt->length = FMT_DIGIT0 + HexFmtDigits(fmt)
+        + ((terminator == FMT_TERM_CRLF) ? 2u : (terminator == FMT_TERM_NONE) ? 0u : 1u);
+    Host_PlainInit(&fmt->input, Name(name, "INPUT"), &fmt->inputCell, width / 8u);
+    fmt->input.read = HexFmtInputRead;
+    fmt->input.write = HexFmtInputWrite;
+    fmt->input.model = fmt;
+    Host_PlainInit(&fmt->output, Name(name, "OUTPUT"), &fmt->outputCell, 1u);
+    fmt->output.read = HexFmtOutputRead;
+    fmt->output.write = HexFmtOutputWrite;
+    fmt->output.model = fmt;
+    for (i = 0; i < 2u; i++) {
+        Host_PlainInit(&fmt->prefix[i], Name(name, prefixes[i]), &fmt->prefixCell[i], 1u);
+    }
+    fmt->model.name = name;
+    fmt->model.step = HexFmtStep;
+    fmt->model.active = HexFmtActive;
+    fmt->model.report = HexFmtReport;
+    fmt->model.state = fmt;
+    Host_ModelAdd(&fmt->model);
+}
+
+uint8 Host_HexFmtDreq(const Host_HexFmt *fmt) {
+    return (fmt->count < HOST_FIFO_DEPTH) ? 1u : 0u;
+}
+
+uint8 Host_HexFmtReady(const Host_HexFmt *fmt) {
+    return fmt->outCount ? 1u : 0u;
+}
+
+//**************************************************************
+//  NtanPureRegister
+//**************************************************************
+void Host_PureRegisterInit(Host_PureRegister *pr, const char *name, uint8 width) {
+    static const char *const regs[4] = { "A0", "A1", "D0", "D1" };
+    uint8 i;
+    memset(pr, 0, sizeof *pr);
+    for (i = 0; i < 4u; i++) {
+        Host_PlainInit(&pr->reg[i], Name(name, regs[i]), &pr->cell[i], width / 8u);
+    }
+}
+
+//**************************************************************
+//  UART, TX only without flow control
+//**************************************************************
+static void UartTxDataWrite(Host_Reg *reg, uint32 value) {
+    Host_Uart *uart = reg->model;
+    if (uart->console) Host_ConsolePut((char)value);
+}
+
+void Host_UartInit(Host_Uart *uart, const char *name, uint8 console) {
+    memset(uart, 0, sizeof *uart);
+    uart->console = console;
+    Host_PlainInit(&uart->txData, Name(name, "TXDATA"), &uart->txDataCell, 1u);
+    uart->txData.write = UartTxDataWrite;
+    uart->txData.model = uart;
+}
+
+void Host_UartPutChar(Host_Uart *uart, char c) {
+    Host_RegWrite(&uart->txData, (uint8)c);
+}
+
+void Host_UartPutString(Host_Uart *uart, const char *s) {
+    while (*s) Host_UartPutChar(uart, *s++);
+}
+
+//**************************************************************
+//  Interrupt from a clock
+//**************************************************************
+static void TimerStep(Host_Model *model) {
+    Host_Timer *timer = model->state;
+    if (++timer->count >= timer->period) {
+        timer->count = 0u;
+        Host_IsrSetPending(timer->isr);
+    }
+}
+
+static uint8 TimerActive(Host_Model *model) {
+    Host_Timer *timer = model->state;
+    return timer->isr->enabled;
+}
+
+void Host_TimerInit(Host_Timer *timer, const char *name, uint32 period, Host_Isr *isr) {
+    memset(timer, 0, sizeof *timer);
+    timer->period = period ? period : 1u;
+    timer->isr = isr;
+    timer->model.name = name;
+    timer->model.step = TimerStep;
+    timer->model.active = TimerActive;
+    timer->model.state = timer;
+    Host_ModelAdd(&timer->model);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,209 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Cycle models of the DpLibrary components and of the
+// Cypress components used around them.
+
+#if !defined(CY_HOST_CYHOST_MODELS_H)
+#define CY_HOST_CYHOST_MODELS_H
+
+#include "cyhost.h"
+
+#define HOST_FIFO_DEPTH     (4u)
+
+// Plain storage register
+extern void Host_PlainInit(Host_Reg *reg, const char *name,
+    volatile void *addr, uint8 size);
+
+//**************************************************************
+//  Accumulator8/16/32
+//**************************************************************
+typedef struct Host_Acc {
+    uint8       width;
+    uint8       inputWidth;     // Bits of a sample
+    uint8       inputSigned;    // Sign extend a narrow sample and the mean
+    uint32      div;            // BUS_CLK cycles per clock
+    uint32      phase;
+    Host_Isr    *ready;         // Falling edge of BUSY
+    uint32      fifo[HOST_FIFO_DEPTH];
+    uint8       head;
+    uint8       count;
+    uint32      a0;
+    uint32      a1;             // Mean
+    uint32      d0;
+    uint8       state;
+    uint8       meanShift;
+    uint8       shifts;         // SHIFTs left before ROUND
+    uint8       meanSign;       // MSB of A0 at COPY
+    uint8       meanCarry;      // Carry out of ROUND
+    uint32      inputCell;
+    uint32      accumulatorCell;
+    uint32      meanCell;
+    uint8       resultFifo;     // Push the sum into F1 when drained
+    uint32      results[HOST_FIFO_DEPTH];
+    uint8       resultHead;
+    uint8       resultCount;
+    uint32      resultCell;
+    void        (*done)(void *context);     // DONE output, or NULL
+    void        *doneContext;
+    uint32      d1;             // Threshold
+    uint8       over;           // OVER_THRESHOLD output
+    Host_Isr    *overIsr;       // Rising edge of OVER_THRESHOLD
+    uint32      thresholdCell;
+    Host_Reg    input;
+    Host_Reg    accumulator;
+    Host_Reg    mean;
+    Host_Reg    result;
+    Host_Reg    threshold;
+    Host_Model  model;
+    // Statistics
+    unsigned long items;
+    unsigned long lost;         // Written while the FIFO is FULL
+    unsigned long long busyCycles;
+} Host_Acc;
+
+extern void Host_AccInit(Host_Acc *acc, const char *name, uint8 width,
+    uint32 div, Host_Isr *ready);
+extern void Host_AccMeanShift(Host_Acc *acc, uint8 shift);
+extern void Host_AccInput(Host_Acc *acc, uint8 width, uint8 sign);
+extern void Host_AccResultFifo(Host_Acc *acc,
+    void (*done)(void *context), void *context);
+extern void Host_AccOverThreshold(Host_Acc *acc, Host_Isr *isr);
+extern uint8 Host_AccDreq(const Host_Acc *acc);
+extern uint8 Host_AccBusy(const Host_Acc *acc);
+extern uint8 Host_AccResultReady(const Host_Acc *acc);
+
+//**************************************************************
+//  NtanTimestamp on BUS_CLK
+//**************************************************************
+typedef struct Host_Timestamp {
+    uint8       width;
+    uint32      count;
+    uint32      fifo[HOST_FIFO_DEPTH];
+    uint8       head;
+    uint8       n;
+    uint32      timestampCell;
+    Host_Reg    timestamp;
+    Host_Model  model;
+    // Statistics
+    unsigned long captures;
+    unsigned long lost;         // Captured while the FIFO is FULL
+} Host_Timestamp;
+
+extern void Host_TimestampInit(Host_Timestamp *ts, const char *name, uint8 width);
+extern void Host_TimestampCapture(void *context);
+extern uint8 Host_TimestampReady(const Host_Timestamp *ts);
+extern uint32 Host_TimestampCount(const Host_Timestamp *ts);
+
+//**************************************************************
+//  NtanUartTx, 8N1
+//**************************************************************
+typedef struct Host_UartTx {
+    uint32      div;            // BUS_CLK cycles per bit
+    uint32      phase;
+    uint8       fifo[HOST_FIFO_DEPTH];
+    uint8       head;
+    uint8       count;
+    uint8       shift;
+    uint8       nbit;
+    uint8       state;
+    uint8       tx;
+    uint8       data;           // Character in the shifter
+    uint8       console;        // Copy the characters sent to stdout
+    uint8       inputCell;
+    Host_Reg    input;
+    Host_Model  model;
+    // Statistics
+    unsigned long chars;
+    unsigned long lost;
+    unsigned long gaps;         // Idle bit times between characters
+    uint8       started;
+} Host_UartTx;
+
+extern void Host_UartTxInit(Host_UartTx *tx, const char *name, uint32 div);
+extern void Host_UartTxConsole(Host_UartTx *tx);
+extern uint8 Host_UartTxDreq(const Host_UartTx *tx);
+
+//**************************************************************
+//  NtanHexFormatter on BUS_CLK
+//**************************************************************
+typedef struct Host_HexFmt {
+    uint8       width;
+    uint8       terminator;
+    uint8       decimal;
+    uint32      fifo[HOST_FIFO_DEPTH];  // INPUT
+    uint8       head;
+    uint8       count;
+    uint8       out[HOST_FIFO_DEPTH];   // OUTPUT
+    uint8       outHead;
+    uint8       outCount;
+    uint32      word;           // A0 of the word datapath
+    uint8       busy;
+    uint8       part;           // Character of the line in progress
+    uint8       length;         // Characters of a line
+    uint32      wait;           // Clocks before the character is pushed
+    uint32      inputCell;
+    uint8       outputCell;
+    uint8       prefixCell[2];
+    Host_Reg    input;
+    Host_Reg    output;
+    Host_Reg    prefix[2];
+    Host_Model  model;
+    // Statistics
+    unsigned long words;
+    unsigned long chars;
+    unsigned long lost;         // Written while INPUT is FULL
+    unsigned long long stalls;  // Clocks waiting for OUTPUT
+} Host_HexFmt;
+
+extern void Host_HexFmtInit(Host_HexFmt *fmt, const char *name, uint8 width,
+    uint8 terminator, uint8 decimal);
+extern uint8 Host_HexFmtDreq(const Host_HexFmt *fmt);
+extern uint8 Host_HexFmtReady(const Host_HexFmt *fmt);
+
+//**************************************************************
+//  NtanPureRegister
+//**************************************************************
+typedef struct Host_PureRegister {
+    uint32      cell[4];        // A0, A1, D0, D1
+    Host_Reg    reg[4];
+} Host_PureRegister;
+
+extern void Host_PureRegisterInit(Host_PureRegister *pr, const char *name, uint8 width);
+
+//**************************************************************
+//  UART, TX only without flow control
+//**************************************************************
+typedef struct Host_Uart {
+    uint8       console;        // Copy to stdout
+    uint8       txDataCell;
+    Host_Reg    txData;
+} Host_Uart;
+
+extern void Host_UartInit(Host_Uart *uart, const char *name, uint8 console);
+extern void Host_UartPutChar(Host_Uart *uart, char c);
+extern void Host_UartPutString(Host_Uart *uart, const char *s);
+
+//**************************************************************
+//  Interrupt from a clock
+//**************************************************************
+typedef struct Host_Timer {
+    uint32      period;
+    uint32      count;
+    Host_Isr    *isr;
+    Host_Model  model;
+} Host_Timer;
+
+extern void Host_TimerInit(Host_Timer *timer, const char *name, uint32 period, Host_Isr *isr);
+
+#endif  // CY_HOST_CYHOST_MODELS_H
+/* [] END OF FILE */
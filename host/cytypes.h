@@ -0,0 +1,86 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Host replacement of cytypes.h
+//
+// uint32 is 32 bits wide as on PSoC 5LP, so the layout of the
+// data handed to DMA is the same.  The firmware is linked with
+// -no-pie to keep its static data below 4GB, and LO16() passes
+// such an address unchanged to the mocked DMA functions.
+
+#if !defined(CY_HOST_CYTYPES_H)
+#define CY_HOST_CYTYPES_H
+
+#include <stddef.h>
+
+typedef unsigned char   uint8;
+typedef unsigned short  uint16;
+typedef unsigned int    uint32;
+typedef signed char     int8;
+typedef signed short    int16;
+typedef signed int      int32;
+typedef float           float32;
+typedef double          float64;
+typedef char            char8;
+
+typedef uint32          cystatus;
+
+#define CYRET_SUCCESS       (0x00u)
+#define CYRET_BAD_PARAM     (0x01u)
+#define CYRET_INVALID_STATE (0x02u)
+
+typedef volatile uint8  reg8;
+typedef volatile uint16 reg16;
+typedef volatile uint32 reg32;
+
+#define CYBIT           uint8
+#define CYCODE
+#define CYDATA
+#define CYXDATA
+#define CYPDATA
+#define CYFAR
+#define CYPACKED
+#define CYPACKED_ATTR   __attribute__ ((packed))
+#define CYALIGNED       __attribute__ ((aligned))
+#define CY_INLINE       inline
+
+#define CY_ISR(FuncName)        void FuncName (void)
+#define CY_ISR_PROTO(FuncName)  void FuncName (void)
+typedef void (* cyisraddress)(void);
+
+// Addresses are not truncated on the host
+#define LO8(x)          ((uint8) ((x) & 0xFFu))
+#define HI8(x)          ((uint8) ((uint16)(x) >> 8))
+#define LO16(x)         ((uint32) (x))
+#define HI16(x)         ((uint32) (x) & 0u)
+
+#define CYDEV_FLASH_BASE    (0u)
+#define CYDEV_SRAM_BASE     (0u)
+#define CYDEV_PERIPH_BASE   (0u)
+
+// Register access through a mocked register, see cyhost.h
+extern uint32 Host_Read(const volatile void *addr, uint8 size);
+extern void Host_Write(volatile void *addr, uint8 size, uint32 value);
+
+#define CY_GET_REG8(addr)           ((uint8) Host_Read((addr), 1u))
+#define CY_SET_REG8(addr, value)    Host_Write((addr), 1u, (uint32)(value))
+#define CY_GET_REG16(addr)          ((uint16) Host_Read((addr), 2u))
+#define CY_SET_REG16(addr, value)   Host_Write((addr), 2u, (uint32)(value))
+#define CY_GET_REG32(addr)          ((uint32) Host_Read((addr), 4u))
+#define CY_SET_REG32(addr, value)   Host_Write((addr), 4u, (uint32)(value))
+
+extern void Host_IntEnable(uint8 enable);
+#define CyGlobalIntEnable   do { Host_IntEnable(1u); } while (0)
+#define CyGlobalIntDisable  do { Host_IntEnable(0u); } while (0)
+
+#endif  // CY_HOST_CYTYPES_H
+/* [] END OF FILE */
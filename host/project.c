@@ -0,0 +1,533 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+#include "project.h"
+
+#if !defined(HOST_ACC_DIV)
+#define HOST_ACC_DIV        (1u)    // ACC clock is BUS_CLK
+#endif
+#if !defined(HOST_UARTTX_DIV)
+#define HOST_UARTTX_DIV     (208u)  // 115200bps from 24MHz
+#endif
+#if !defined(HOST_SAMPLE_DIV)
+#define HOST_SAMPLE_DIV     (2400u) // 10kHz from 24MHz
+#endif
+
+#define SR1_DREQ    (0x01u)
+#define SR1_BIT1    (0x02u)
+
+//**************************************************************
+//  Console UART
+//**************************************************************
+Host_Uart UART_host;
+
+void UART_Start(void) {
+}
+
+void UART_PutChar(uint8 txDataByte) {
+    Host_UartPutChar(&UART_host, (char)txDataByte);
+}
+
+void UART_PutString(const char8 string[]) {
+    Host_UartPutString(&UART_host, string);
+}
+
+void UART_PutCRLF(uint8 txDataByte) {
+    UART_PutChar(txDataByte);
+    UART_PutChar('\r');
+    UART_PutChar('\n');
+}
+
+//**************************************************************
+//  SR1 status register and switches
+//**************************************************************
+static uint8 sr1Cell;
+static uint8 pinCell[2];
+static Host_Reg sr1;
+static Host_Reg pinSw1;
+static Host_Reg pinBtn;
+
+static uint32 Sr1Read(Host_Reg *reg) {
+    uint8 value = 0u;
+    (void)reg;
+#if defined(HOST_ACC_WIDTH)
+    if (Host_AccDreq(&ACC_host)) value |= SR1_DREQ;
+    if (Host_AccBusy(&ACC_host)) value |= SR1_BIT1;
+#elif defined(HOST_UARTTX)
+    if (Host_UartTxDreq(&UartTx_host)) value |= SR1_DREQ;
+    if (Host_Switch()) value |= SR1_BIT1;
+#endif
+    return value;
+}
+
+static uint32 PinRead(Host_Reg *reg) {
+    (void)reg;
+    return Host_Switch();
+}
+
+uint8 SR1_Read(void) {
+    return (uint8)Host_RegRead(&sr1);
+}
+
+uint8 Pin_SW1_Read(void) {
+    return (uint8)Host_RegRead(&pinSw1);
+}
+
+uint8 Pin_BTN_Read(void) {
+    return (uint8)Host_RegRead(&pinBtn);
+}
+
+//**************************************************************
+//  Cortex-M3 DWT cycle counter
+//**************************************************************
+uint32 DWT_host[3];
+static Host_Reg demcr;
+static Host_Reg dwtCtrl;
+static Host_Reg dwtCyccnt;
+static unsigned long long cyccntBase;
+
+static uint32 CyccntRead(Host_Reg *reg) {
+    (void)reg;
+    return (uint32)((Host_Cycles() - cyccntBase) & 0xFFFFFFFFull);
+}
+
+static void CyccntWrite(Host_Reg *reg, uint32 value) {
+    (void)reg;
+    cyccntBase = Host_Cycles() - value;
+}
+
+//**************************************************************
+//  Accumulator8/16/32 as ACC
+//**************************************************************
+#if defined(HOST_ACC_WIDTH)
+Host_Acc ACC_host;
+Host_Isr int_Ready_host = { "int_Ready", NULL, 0u, 0u, 0ul, NULL };
+Host_Isr int_Req_host = { "int_Req", NULL, 0u, 0u, 0ul, NULL };
+Host_Isr int_DmaDone_host = { "int_DmaDone", NULL, 0u, 0u, 0ul, NULL };
+Host_Isr int_Over_host = { "int_Over", NULL, 0u, 0u, 0ul, NULL };
+static Host_Model reqLevel;
+
+static uint8 AccDrq(void) {
+    return Host_AccDreq(&ACC_host);
+}
+
+Host_DmaCh DMA_host = { "DMA", AccDrq, &int_DmaDone_host };
+
+// int_Req is pending as long as dreq is HIGH
+static void ReqStep(Host_Model *model) {
+    (void)model;
+    if (AccDrq()) Host_IsrSetPending(&int_Req_host);
+    else Host_IsrClearPending(&int_Req_host);
+}
+
+#if (HOST_ACC_WIDTH == 32)
+void ACC_WriteValue(uint32 value) {
+    Host_RegWrite(&ACC_host.input, value);
+}
+
+uint32 ACC_ReadAccumulator(void) {
+    return Host_RegRead(&ACC_host.accumulator);
+}
+
+uint32 ACC_ReadMean(void) {
+    return Host_RegRead(&ACC_host.mean);
+}
+
+uint32 ACC_ReadResult(void) {
+    return Host_RegRead(&ACC_host.result);
+}
+
+#if (ACC_INPUT_SIGNED == 0u)
+void ACC_SetThreshold(uint32 value) {
+    Host_RegWrite(&ACC_host.threshold, value);
+}
+#endif
+#elif (HOST_ACC_WIDTH == 16)
+void ACC_WriteValue(uint16 value) {
+    Host_RegWrite(&ACC_host.input, value);
+}
+
+uint16 ACC_ReadAccumulator(void) {
+    return (uint16)Host_RegRead(&ACC_host.accumulator);
+}
+
+uint16 ACC_ReadMean(void) {
+    return (uint16)Host_RegRead(&ACC_host.mean);
+}
+
+uint16 ACC_ReadResult(void) {
+    return (uint16)Host_RegRead(&ACC_host.result);
+}
+
+#if (ACC_INPUT_SIGNED == 0u)
+void ACC_SetThreshold(uint16 value) {
+    Host_RegWrite(&ACC_host.threshold, value);
+}
+#endif
+#else
+void ACC_WriteValue(uint8 value) {
+    Host_RegWrite(&ACC_host.input, value);
+}
+
+uint8 ACC_ReadAccumulator(void) {
+    return (uint8)Host_RegRead(&ACC_host.accumulator);
+}
+
+uint8 ACC_ReadMean(void) {
+    return (uint8)Host_RegRead(&ACC_host.mean);
+}
+
+uint8 ACC_ReadResult(void) {
+    return (uint8)Host_RegRead(&ACC_host.result);
+}
+
+#if (ACC_INPUT_SIGNED == 0u)
+void ACC_SetThreshold(uint8 value) {
+    Host_RegWrite(&ACC_host.threshold, value);
+}
+#endif
+#endif
+
+void ACC_ClearAccumulator(void) {
+    Host_RegWrite(&ACC_host.accumulator, 0u);
+#if (ACC_MEAN_SHIFT > 0)
+    Host_RegWrite(&ACC_host.mean, 0u);
+#endif
+}
+
+#if defined(HOST_TS)
+Host_Timestamp TS_host;
+
+uint32 TS_ReadTimestamp(void) {
+    return Host_RegRead(&TS_host.timestamp);
+}
+
+// The live counter is read as two halves and the upper again
+uint32 TS_ReadCount(void) {
+    uint32 count;
+    Host_Enter();
+    Host_Advance(3u * HOST_COST_REG);
+    count = Host_TimestampCount(&TS_host);
+    Host_Leave();
+    return count;
+}
+#endif
+#endif
+
+//**************************************************************
+//  Accumulator lanes
+//**************************************************************
+#if defined(HOST_ACC_LANES)
+Host_Acc ACC_lanes_host[HOST_ACC_LANES_MAX];
+uint8 SR_Done_host;
+static Host_Reg srDone;
+static uint8 srDoneBits;
+
+static uint8 Lane1Drq(void) { return Host_AccDreq(&ACC_lanes_host[0]); }
+static uint8 Lane2Drq(void) { return Host_AccDreq(&ACC_lanes_host[1]); }
+static uint8 Lane3Drq(void) { return Host_AccDreq(&ACC_lanes_host[2]); }
+static uint8 Lane4Drq(void) { return Host_AccDreq(&ACC_lanes_host[3]); }
+
+Host_DmaCh DMA_lanes_host[HOST_ACC_LANES_MAX] = {
+    { "DMA_1", Lane1Drq, NULL },
+    { "DMA_2", Lane2Drq, NULL },
+    { "DMA_3", Lane3Drq, NULL },
+    { "DMA_4", Lane4Drq, NULL },
+};
+
+// DONE of a lane sets its sticky bit
+static void LaneDone(void *context) {
+    srDoneBits |= (uint8)(1u << ((Host_Acc *)context - ACC_lanes_host));
+}
+
+// A read clears the sticky bits
+static uint32 SrDoneRead(Host_Reg *reg) {
+    uint8 value = srDoneBits;
+    (void)reg;
+    srDoneBits = 0u;
+    return value;
+}
+#endif
+
+//**************************************************************
+//  NtanUartTx as UartTx
+//**************************************************************
+#if defined(HOST_UARTTX)
+Host_UartTx UartTx_host;
+Host_Uart Probe_UART_host;
+Host_Isr int_Sample_host = { "int_Sample", NULL, 0u, 0u, 0ul, NULL };
+static Host_Timer sampleClock;
+static uint8 probeCell;
+static Host_Reg probe;
+
+static uint8 UartTxDrq(void) {
+    return Host_UartTxDreq(&UartTx_host);
+}
+
+Host_DmaCh DMA_UartTx_host = { "DMA_UartTx", UartTxDrq, NULL };
+
+static uint32 ProbeRead(Host_Reg *reg) {
+    (void)reg;
+    return UartTx_host.tx;
+}
+
+void UartTx_WriteValue(uint8 value) {
+    Host_RegWrite(&UartTx_host.input, value);
+}
+
+// Segment list transmit, the same as the component API
+static uint8 UartTx_channel = CY_DMA_INVALID_CHANNEL;
+static uint8 UartTx_td[UartTx_MAX_SEGMENTS];
+static uint16 UartTx_upper[UartTx_MAX_SEGMENTS];
+static uint8 UartTx_nTds;
+static uint8 UartTx_count;
+static uint8 UartTx_next;
+
+static void UartTx_StartRun(void) {
+    uint8 first = UartTx_next;
+    uint16 upper = UartTx_upper[first];
+    while (UartTx_next < UartTx_count && UartTx_upper[UartTx_next] == upper) {
+        UartTx_next++;
+    }
+    CyDmaChSetExtendedAddress(UartTx_channel, upper, HI16(CYDEV_PERIPH_BASE));
+    CyDmaChSetInitialTd(UartTx_channel, UartTx_td[first]);
+    CyDmaChEnable(UartTx_channel, 1u);
+}
+
+cystatus UartTx_Send(uint8 channel, const UartTx_segment segments[], uint8 count) {
+    uint8 n;
+    uint8 intState;
+    if (channel == CY_DMA_INVALID_CHANNEL || count == 0u || count > UartTx_MAX_SEGMENTS) {
+        return CYRET_BAD_PARAM;
+    }
+    for (n = 0u; n < count; n++) {
+        if (segments[n].bytes == 0u || segments[n].bytes > UartTx_SEGMENT_MAX) {
+            return CYRET_BAD_PARAM;
+        }
+        // A TD does not carry over into the next 64KB
+        if (HI16((uint32)segments[n].data)
+                != HI16((uint32)segments[n].data + segments[n].bytes - 1u)) {
+            return CYRET_BAD_PARAM;
+        }
+    }
+    if (UartTx_Busy()) {
+        return CYRET_INVALID_STATE;
+    }
+    while (UartTx_nTds < count) {
+        uint8 td = CyDmaTdAllocate();
+        if (td == CY_DMA_INVALID_TD) {
+            return CYRET_INVALID_STATE;
+        }
+        UartTx_td[UartTx_nTds++] = td;
+    }
+    for (n = 0u; n < count; n++) {
+        uint32 src = (uint32)segments[n].data;
+        uint8 last = (n + 1u == count)
+            || (HI16(src) != HI16((uint32)segments[n + 1u].data));
+        UartTx_upper[n] = HI16(src);
+        CyDmaTdSetConfiguration(UartTx_td[n], segments[n].bytes,
+            last ? CY_DMA_DISABLE_TD : UartTx_td[n + 1u],
+            last ? (CY_DMA_TD_INC_SRC_ADR | CY_DMA_TD_TERMOUT0_EN) : CY_DMA_TD_INC_SRC_ADR);
+        CyDmaTdSetAddress(UartTx_td[n], LO16(src), LO16((uint32)UartTx_INPUT_PTR));
+    }
+    intState = CyEnterCriticalSection();
+    UartTx_channel = channel;
+    UartTx_count = count;
+    UartTx_next = 0u;
+    UartTx_StartRun();
+    CyExitCriticalSection(intState);
+    return CYRET_SUCCESS;
+}
+
+void UartTx_Poll(void) {
+    uint8 state;
+    uint8 intState = CyEnterCriticalSection();
+    if (UartTx_next < UartTx_count) {
+        CyDmaChStatus(UartTx_channel, NULL, &state);
+        if (!(state & CY_DMA_STATUS_CHAIN_ACTIVE)) {
+            UartTx_StartRun();
+        }
+    }
+    CyExitCriticalSection(intState);
+}
+
+uint8 UartTx_Busy(void) {
+    uint8 state = 0u;
+    uint8 intState = CyEnterCriticalSection();
+    if (UartTx_next < UartTx_count) {
+        state = CY_DMA_STATUS_CHAIN_ACTIVE;
+    } else if (UartTx_channel != CY_DMA_INVALID_CHANNEL) {
+        CyDmaChStatus(UartTx_channel, NULL, &state);
+    }
+    CyExitCriticalSection(intState);
+    return (state & CY_DMA_STATUS_CHAIN_ACTIVE) ? 1u : 0u;
+}
+
+uint8 Probe_Read(void) {
+    return (uint8)Host_RegRead(&probe);
+}
+
+void Probe_UART_Start(void) {
+}
+
+void Probe_UART_PutChar(uint8 txDataByte) {
+    Host_UartPutChar(&Probe_UART_host, (char)txDataByte);
+}
+#endif
+
+//**************************************************************
+//  NtanPureRegister as PR1
+//**************************************************************
+#if defined(HOST_PR_WIDTH)
+Host_PureRegister PR1_host;
+
+PR1_value PR1_ReadA0(void) {
+    return (PR1_value)Host_RegRead(&PR1_host.reg[0]);
+}
+
+void PR1_WriteA0(PR1_value value) {
+    Host_RegWrite(&PR1_host.reg[0], value);
+}
+
+PR1_value PR1_ReadA1(void) {
+    return (PR1_value)Host_RegRead(&PR1_host.reg[1]);
+}
+
+void PR1_WriteA1(PR1_value value) {
+    Host_RegWrite(&PR1_host.reg[1], value);
+}
+
+PR1_value PR1_ReadD0(void) {
+    return (PR1_value)Host_RegRead(&PR1_host.reg[2]);
+}
+
+void PR1_WriteD0(PR1_value value) {
+    Host_RegWrite(&PR1_host.reg[2], value);
+}
+
+PR1_value PR1_ReadD1(void) {
+    return (PR1_value)Host_RegRead(&PR1_host.reg[3]);
+}
+
+void PR1_WriteD1(PR1_value value) {
+    Host_RegWrite(&PR1_host.reg[3], value);
+}
+#endif
+
+//**************************************************************
+//  NtanHexFormatter as Fmt
+//**************************************************************
+#if defined(HOST_HEXFMT)
+Host_HexFmt Fmt_host;
+
+static uint8 FmtDrq(void) {
+#if defined(HOST_UARTTX)
+    return Host_HexFmtReady(&Fmt_host) && Host_UartTxDreq(&UartTx_host);
+#else
+    return Host_HexFmtReady(&Fmt_host);
+#endif
+}
+
+Host_DmaCh DMA_Fmt_host = { "DMA_Fmt", FmtDrq, NULL };
+
+static uint8 ResultDrq(void) {
+#if defined(HOST_ACC_RESULT_FIFO)
+    return Host_AccResultReady(&ACC_host);
+#else
+    return 0u;
+#endif
+}
+
+Host_DmaCh DMA_Result_host = { "DMA_Result", ResultDrq, NULL };
+
+void Fmt_WriteValue(uint32 value) {
+    Host_RegWrite(&Fmt_host.input, value);
+}
+
+void Fmt_SetPrefix(char8 prefix0, char8 prefix1) {
+    Host_RegWrite(&Fmt_host.prefix[0], (uint8)prefix0);
+    Host_RegWrite(&Fmt_host.prefix[1], (uint8)prefix1);
+}
+
+char8 Fmt_ReadChar(void) {
+    return (char8)Host_RegRead(&Fmt_host.output);
+}
+#endif
+
+//**************************************************************
+//  Instances
+//**************************************************************
+__attribute__ ((constructor))
+static void Project_Init(void) {
+    Host_UartInit(&UART_host, "UART", 1u);
+    Host_PlainInit(&sr1, "SR1", &sr1Cell, 1u);
+    sr1.read = Sr1Read;
+    Host_PlainInit(&pinSw1, "Pin_SW1", &pinCell[0], 1u);
+    pinSw1.read = PinRead;
+    Host_PlainInit(&pinBtn, "Pin_BTN", &pinCell[1], 1u);
+    pinBtn.read = PinRead;
+    Host_PlainInit(&demcr, "DEMCR", &DWT_host[0], 4u);
+    Host_PlainInit(&dwtCtrl, "DWT_CTRL", &DWT_host[1], 4u);
+    Host_PlainInit(&dwtCyccnt, "DWT_CYCCNT", &DWT_host[2], 4u);
+    dwtCyccnt.read = CyccntRead;
+    dwtCyccnt.write = CyccntWrite;
+#if defined(HOST_ACC_WIDTH)
+    Host_AccInit(&ACC_host, "ACC", HOST_ACC_WIDTH, HOST_ACC_DIV, &int_Ready_host);
+    Host_AccMeanShift(&ACC_host, ACC_MEAN_SHIFT);
+    Host_AccOverThreshold(&ACC_host, &int_Over_host);
+#if defined(HOST_ACC_INPUT_WIDTH)
+    Host_AccInput(&ACC_host, HOST_ACC_INPUT_WIDTH, ACC_INPUT_SIGNED);
+#else
+    Host_AccInput(&ACC_host, HOST_ACC_WIDTH, ACC_INPUT_SIGNED);
+#endif
+#if defined(HOST_TS)
+    Host_TimestampInit(&TS_host, "TS", TS_WIDTH);
+    Host_AccResultFifo(&ACC_host, Host_TimestampCapture, &TS_host);
+#elif defined(HOST_ACC_RESULT_FIFO)
+    Host_AccResultFifo(&ACC_host, NULL, NULL);
+#endif
+    reqLevel.name = "int_Req";
+    reqLevel.step = ReqStep;
+    Host_ModelAdd(&reqLevel);
+#endif
+#if defined(HOST_ACC_LANES)
+    {
+        static const char *names[HOST_ACC_LANES_MAX] = { "ACC_1", "ACC_2", "ACC_3", "ACC_4" };
+        uint8 i;
+        for (i = 0; i < HOST_ACC_LANES; i++) {
+            Host_AccInit(&ACC_lanes_host[i], names[i], HOST_ACC_WIDTH, HOST_ACC_DIV, NULL);
+            Host_AccResultFifo(&ACC_lanes_host[i], LaneDone, &ACC_lanes_host[i]);
+        }
+    }
+    Host_PlainInit(&srDone, "SR_Done", &SR_Done_host, 1u);
+    srDone.read = SrDoneRead;
+#endif
+#if defined(HOST_UARTTX)
+    Host_UartTxInit(&UartTx_host, "UartTx", HOST_UARTTX_DIV);
+    Host_UartInit(&Probe_UART_host, "Probe_UART", 0u);
+    Host_PlainInit(&probe, "Probe", &probeCell, 1u);
+    probe.read = ProbeRead;
+    Host_TimerInit(&sampleClock, "Clock_Sample", HOST_SAMPLE_DIV, &int_Sample_host);
+#endif
+#if defined(HOST_PR_WIDTH)
+    Host_PureRegisterInit(&PR1_host, "PR1", HOST_PR_WIDTH);
+#endif
+#if defined(HOST_HEXFMT)
+    Host_HexFmtInit(&Fmt_host, "Fmt", HOST_HEXFMT, HOST_HEXFMT_TERMINATOR,
+        HOST_HEXFMT_DECIMAL);
+#if defined(HOST_UARTTX)
+    Host_UartTxConsole(&UartTx_host);
+#endif
+#endif
+}
+
+/* [] END OF FILE */
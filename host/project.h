@@ -0,0 +1,339 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+
+// Host replacement of project.h for the test projects
+//
+// The instances of a test project are selected with
+//   -DHOST_ACC_WIDTH=8|16|32   ACC, DMA, int_Ready, int_Over
+//   -DHOST_ACC_INPUT_WIDTH=8|16 narrow INPUT of ACC with HOST_ACC_WIDTH=32
+//   -DHOST_ACC_INPUT_SIGNED=0|1 InputSigned of ACC, the narrow INPUT
+//                              and the mean
+//   -DHOST_ACC_RESULT_FIFO     ResultFifo=1 on ACC
+//   -DHOST_TS                  TS on DONE of ACC with HOST_ACC_RESULT_FIFO
+//   -DHOST_UARTTX              UartTx, DMA_UartTx, Probe, int_Sample
+//   -DHOST_PR_WIDTH=8|16|32    PR1
+//   -DHOST_ACC_LANES=1..4      ACC_n, DMA_n, SR_Done with HOST_ACC_WIDTH
+//   -DHOST_HEXFMT=8|16|32      Fmt, DMA_Fmt into UartTx with HOST_UARTTX,
+//                              DMA_Result from ACC with HOST_ACC_RESULT_FIFO
+// UART, SR1 and the switch inputs are always present.
+//
+// Only the function API and the _PTR macros are provided.
+// A _REG macro would be a plain memory access on the host.
+
+#if !defined(CY_HOST_PROJECT_H)
+#define CY_HOST_PROJECT_H
+
+#include "cytypes.h"
+#include "CyDmac.h"
+#include "CyLib.h"
+#include "cyhost_models.h"
+
+//**************************************************************
+//  Console UART
+//**************************************************************
+extern Host_Uart UART_host;
+extern void UART_Start(void);
+extern void UART_PutChar(uint8 txDataByte);
+extern void UART_PutString(const char8 string[]);
+#define UART_PutStringConst(string) UART_PutString(string)
+extern void UART_PutCRLF(uint8 txDataByte);
+
+//**************************************************************
+//  SR1 status register and switches
+//**************************************************************
+// Bit 0 is DREQ of ACC or UartTx.
+// Bit 1 is BUSY of ACC or the switch.
+extern uint8 SR1_Read(void);
+extern uint8 Pin_SW1_Read(void);
+extern uint8 Pin_BTN_Read(void);
+
+//**************************************************************
+//  Cortex-M3 DWT cycle counter, counts BUS_CLK
+//**************************************************************
+extern uint32 DWT_host[3];
+#define DEMCR_PTR       ((reg32 *) &DWT_host[0])
+#define DWT_CTRL_PTR    ((reg32 *) &DWT_host[1])
+#define DWT_CYCCNT_PTR  ((reg32 *) &DWT_host[2])
+
+//**************************************************************
+//  Accumulator8/16/32 as ACC
+//**************************************************************
+#if defined(HOST_ACC_WIDTH)
+extern Host_Acc ACC_host;
+
+// InputSigned parameter given with -DHOST_ACC_INPUT_SIGNED=1
+#if defined(HOST_ACC_INPUT_SIGNED)
+#define ACC_INPUT_SIGNED    (HOST_ACC_INPUT_SIGNED)
+#else
+#define ACC_INPUT_SIGNED    (0u)
+#endif
+
+#if (HOST_ACC_WIDTH == 32)
+#if (HOST_ACC_INPUT_WIDTH == 8)
+#define ACC_INPUT_PTR       ((reg8 *) &ACC_host.inputCell)
+#elif (HOST_ACC_INPUT_WIDTH == 16)
+#define ACC_INPUT_PTR       ((reg16 *) &ACC_host.inputCell)
+#else
+#define ACC_INPUT_PTR       ((reg32 *) &ACC_host.inputCell)
+#endif
+#define ACC_ACCUMULATOR_PTR ((reg32 *) &ACC_host.accumulatorCell)
+#define ACC_MEAN_PTR        ((reg32 *) &ACC_host.meanCell)
+#define ACC_RESULT_PTR      ((reg32 *) &ACC_host.resultCell)
+#define ACC_THRESHOLD_PTR   ((reg32 *) &ACC_host.thresholdCell)
+extern void ACC_WriteValue(uint32 value);
+extern uint32 ACC_ReadAccumulator(void);
+extern uint32 ACC_ReadMean(void);
+extern uint32 ACC_ReadResult(void);
+#if (ACC_INPUT_SIGNED == 0u)
+extern void ACC_SetThreshold(uint32 value);
+#endif
+#elif (HOST_ACC_WIDTH == 16)
+#define ACC_INPUT_PTR       ((reg16 *) &ACC_host.inputCell)
+#define ACC_ACCUMULATOR_PTR ((reg16 *) &ACC_host.accumulatorCell)
+#define ACC_MEAN_PTR        ((reg16 *) &ACC_host.meanCell)
+#define ACC_RESULT_PTR      ((reg16 *) &ACC_host.resultCell)
+#define ACC_THRESHOLD_PTR   ((reg16 *) &ACC_host.thresholdCell)
+extern void ACC_WriteValue(uint16 value);
+extern uint16 ACC_ReadAccumulator(void);
+extern uint16 ACC_ReadMean(void);
+extern uint16 ACC_ReadResult(void);
+#if (ACC_INPUT_SIGNED == 0u)
+extern void ACC_SetThreshold(uint16 value);
+#endif
+#else
+#define ACC_INPUT_PTR       ((reg8 *) &ACC_host.inputCell)
+#define ACC_ACCUMULATOR_PTR ((reg8 *) &ACC_host.accumulatorCell)
+#define ACC_MEAN_PTR        ((reg8 *) &ACC_host.meanCell)
+#define ACC_RESULT_PTR      ((reg8 *) &ACC_host.resultCell)
+#define ACC_THRESHOLD_PTR   ((reg8 *) &ACC_host.thresholdCell)
+extern void ACC_WriteValue(uint8 value);
+extern uint8 ACC_ReadAccumulator(void);
+extern uint8 ACC_ReadMean(void);
+extern uint8 ACC_ReadResult(void);
+#if (ACC_INPUT_SIGNED == 0u)
+extern void ACC_SetThreshold(uint8 value);
+#endif
+#endif
+extern void ACC_ClearAccumulator(void);
+
+// MeanShift parameter given with -DHOST_ACC_MEAN_SHIFT=k
+#if defined(HOST_ACC_MEAN_SHIFT)
+#define ACC_MEAN_SHIFT      (HOST_ACC_MEAN_SHIFT)
+#else
+#define ACC_MEAN_SHIFT      (0u)
+#endif
+
+// ResultFifo parameter given with -DHOST_ACC_RESULT_FIFO
+#if defined(HOST_ACC_RESULT_FIFO)
+#define ACC_RESULT_FIFO     (1u)
+#else
+#define ACC_RESULT_FIFO     (0u)
+#endif
+
+// TS capturing on DONE of ACC given with -DHOST_TS
+#if defined(HOST_TS)
+extern Host_Timestamp TS_host;
+#define TS_WIDTH            (32u)
+#define TS_TIMESTAMP_PTR    ((reg32 *) &TS_host.timestampCell)
+extern uint32 TS_ReadTimestamp(void);
+extern uint32 TS_ReadCount(void);
+#endif
+
+// DMA requested by ACC dreq
+extern Host_DmaCh DMA_host;
+#define DMA_DmaInitialize(burstCount, requestPerBurst, upperSrcAddress, upperDestAddress) \
+    Host_DmaInitialize(&DMA_host, (burstCount), (requestPerBurst))
+
+// Interrupt on the falling edge of ACC busy
+extern Host_Isr int_Ready_host;
+#define int_Ready_Start()           Host_IsrStart(&int_Ready_host, int_Ready_host.handler)
+#define int_Ready_StartEx(address)  Host_IsrStart(&int_Ready_host, (address))
+#define int_Ready_Stop()            Host_IsrStop(&int_Ready_host)
+#define int_Ready_Enable()          Host_IsrEnable(&int_Ready_host, 1u)
+#define int_Ready_Disable()         Host_IsrEnable(&int_Ready_host, 0u)
+#define int_Ready_SetPending()      Host_IsrSetPending(&int_Ready_host)
+#define int_Ready_ClearPending()    Host_IsrClearPending(&int_Ready_host)
+
+// Interrupt on the rising edge of ACC over_threshold
+extern Host_Isr int_Over_host;
+#define int_Over_StartEx(address)   Host_IsrStart(&int_Over_host, (address))
+#define int_Over_Stop()             Host_IsrStop(&int_Over_host)
+#define int_Over_ClearPending()     Host_IsrClearPending(&int_Over_host)
+
+// Level interrupt while ACC dreq is HIGH
+extern Host_Isr int_Req_host;
+#define int_Req_StartEx(address)    Host_IsrStart(&int_Req_host, (address))
+#define int_Req_Stop()              Host_IsrStop(&int_Req_host)
+#define int_Req_Enable()            Host_IsrEnable(&int_Req_host, 1u)
+#define int_Req_Disable()           Host_IsrEnable(&int_Req_host, 0u)
+#define int_Req_ClearPending()      Host_IsrClearPending(&int_Req_host)
+
+// Interrupt from DMA nrq at the end of a TD with TERMOUT0
+extern Host_Isr int_DmaDone_host;
+#define int_DmaDone_StartEx(address) Host_IsrStart(&int_DmaDone_host, (address))
+#define int_DmaDone_Stop()          Host_IsrStop(&int_DmaDone_host)
+#define int_DmaDone_ClearPending()  Host_IsrClearPending(&int_DmaDone_host)
+#endif
+
+//**************************************************************
+//  Accumulator lanes ACC_1 to ACC_n for a job scheduler
+//**************************************************************
+#if defined(HOST_ACC_LANES)
+#define HOST_ACC_LANES_MAX  (4u)
+extern Host_Acc ACC_lanes_host[HOST_ACC_LANES_MAX];
+extern Host_DmaCh DMA_lanes_host[HOST_ACC_LANES_MAX];
+#define ACC_n_INPUT_PTR(n)          ((void *) &ACC_lanes_host[(n) - 1].inputCell)
+#define ACC_n_ACCUMULATOR_PTR(n)    ((void *) &ACC_lanes_host[(n) - 1].accumulatorCell)
+#define ACC_n_RESULT_PTR(n)         ((void *) &ACC_lanes_host[(n) - 1].resultCell)
+#define ACC_1_INPUT_PTR             ACC_n_INPUT_PTR(1)
+#define ACC_1_ACCUMULATOR_PTR       ACC_n_ACCUMULATOR_PTR(1)
+#define ACC_2_INPUT_PTR             ACC_n_INPUT_PTR(2)
+#define ACC_2_ACCUMULATOR_PTR       ACC_n_ACCUMULATOR_PTR(2)
+#define ACC_3_INPUT_PTR             ACC_n_INPUT_PTR(3)
+#define ACC_3_ACCUMULATOR_PTR       ACC_n_ACCUMULATOR_PTR(3)
+#define ACC_4_INPUT_PTR             ACC_n_INPUT_PTR(4)
+#define ACC_4_ACCUMULATOR_PTR       ACC_n_ACCUMULATOR_PTR(4)
+#define DMA_n_DmaInitialize(n, burstCount, requestPerBurst) \
+    Host_DmaInitialize(&DMA_lanes_host[(n) - 1], (burstCount), (requestPerBurst))
+
+// Bit n-1 is DONE of ACC_n with ResultFifo=1, sticky
+extern uint8 SR_Done_host;
+#define SR_Done_Status_PTR          ((reg8 *) &SR_Done_host)
+#endif
+
+//**************************************************************
+//  NtanUartTx as UartTx
+//**************************************************************
+#if defined(HOST_UARTTX)
+extern Host_UartTx UartTx_host;
+#define UartTx_INPUT_PTR    ((reg8 *) &UartTx_host.inputCell)
+#define UartTx_MAX_SEGMENTS (8u)
+#define UartTx_SEGMENT_MAX  (4095u)
+typedef struct {
+    const volatile void *data;
+    uint16      bytes;
+} UartTx_segment;
+extern void UartTx_WriteValue(uint8 value);
+extern cystatus UartTx_Send(uint8 channel, const UartTx_segment segments[], uint8 count);
+extern void UartTx_Poll(void);
+extern uint8 UartTx_Busy(void);
+
+// DMA requested by UartTx dreq
+extern Host_DmaCh DMA_UartTx_host;
+#define DMA_UartTx_DmaInitialize(burstCount, requestPerBurst, upperSrcAddress, upperDestAddress) \
+    Host_DmaInitialize(&DMA_UartTx_host, (burstCount), (requestPerBurst))
+
+// Logic analyzer: Probe bit 0 is TX
+extern uint8 Probe_Read(void);
+extern Host_Uart Probe_UART_host;
+extern void Probe_UART_Start(void);
+extern void Probe_UART_PutChar(uint8 txDataByte);
+
+extern Host_Isr int_Sample_host;
+#define int_Sample_Start()          Host_IsrStart(&int_Sample_host, int_Sample_host.handler)
+#define int_Sample_StartEx(address) Host_IsrStart(&int_Sample_host, (address))
+#define int_Sample_Stop()           Host_IsrStop(&int_Sample_host)
+#define int_Sample_Enable()         Host_IsrEnable(&int_Sample_host, 1u)
+#define int_Sample_Disable()        Host_IsrEnable(&int_Sample_host, 0u)
+#define int_Sample_SetPending()     Host_IsrSetPending(&int_Sample_host)
+#define int_Sample_ClearPending()   Host_IsrClearPending(&int_Sample_host)
+#endif
+
+//**************************************************************
+//  NtanPureRegister as PR1
+//**************************************************************
+#if defined(HOST_PR_WIDTH)
+extern Host_PureRegister PR1_host;
+#if (HOST_PR_WIDTH == 32)
+typedef uint32 PR1_value;
+typedef reg32 PR1_reg;
+#elif (HOST_PR_WIDTH == 16)
+typedef uint16 PR1_value;
+typedef reg16 PR1_reg;
+#else
+typedef uint8 PR1_value;
+typedef reg8 PR1_reg;
+#endif
+#define PR1_WIDTH   (HOST_PR_WIDTH)
+#define PR1_A0_PTR  ((PR1_reg *) &PR1_host.cell[0])
+#define PR1_A1_PTR  ((PR1_reg *) &PR1_host.cell[1])
+#define PR1_D0_PTR  ((PR1_reg *) &PR1_host.cell[2])
+#define PR1_D1_PTR  ((PR1_reg *) &PR1_host.cell[3])
+extern PR1_value PR1_ReadA0(void);
+extern void PR1_WriteA0(PR1_value value);
+extern PR1_value PR1_ReadA1(void);
+extern void PR1_WriteA1(PR1_value value);
+extern PR1_value PR1_ReadD0(void);
+extern void PR1_WriteD0(PR1_value value);
+extern PR1_value PR1_ReadD1(void);
+extern void PR1_WriteD1(PR1_value value);
+#endif
+
+//**************************************************************
+//  NtanHexFormatter as Fmt
+//**************************************************************
+#if defined(HOST_HEXFMT)
+#if !defined(HOST_HEXFMT_TERMINATOR)
+#define HOST_HEXFMT_TERMINATOR  (1u)    // CR LF
+#endif
+#if !defined(HOST_HEXFMT_DECIMAL)
+#define HOST_HEXFMT_DECIMAL     (0u)    // Hexadecimal
+#endif
+extern Host_HexFmt Fmt_host;
+#define Fmt_WIDTH       (HOST_HEXFMT)
+#define Fmt_DECIMAL     (HOST_HEXFMT_DECIMAL)
+#if (Fmt_DECIMAL == 0u)
+#define Fmt_DIGITS      (Fmt_WIDTH / 4u)
+#elif (Fmt_WIDTH == 8u)
+#define Fmt_DIGITS      (3u)
+#elif (Fmt_WIDTH == 16u)
+#define Fmt_DIGITS      (5u)
+#else
+#define Fmt_DIGITS      (10u)
+#endif
+#define Fmt_TERMINATOR  (HOST_HEXFMT_TERMINATOR)
+#define Fmt_TERM_NONE   (0u)
+#define Fmt_TERM_CRLF   (1u)
+#define Fmt_TERM_LF     (2u)
+#define Fmt_TERM_CR     (3u)
+#if (Fmt_TERMINATOR == Fmt_TERM_CRLF)
+#define Fmt_LINE_LENGTH (Fmt_DIGITS + 2u)
+#elif (Fmt_TERMINATOR == Fmt_TERM_NONE)
+#define Fmt_LINE_LENGTH (Fmt_DIGITS)
+#else
+#define Fmt_LINE_LENGTH (Fmt_DIGITS + 1u)
+#endif
+#if (HOST_HEXFMT == 32)
+#define Fmt_INPUT_PTR   ((reg32 *) &Fmt_host.inputCell)
+#elif (HOST_HEXFMT == 16)
+#define Fmt_INPUT_PTR   ((reg16 *) &Fmt_host.inputCell)
+#else
+#define Fmt_INPUT_PTR   ((reg8 *) &Fmt_host.inputCell)
+#endif
+#define Fmt_OUTPUT_PTR  ((reg8 *) &Fmt_host.outputCell)
+extern void Fmt_WriteValue(uint32 value);
+extern void Fmt_SetPrefix(char8 prefix0, char8 prefix1);
+extern char8 Fmt_ReadChar(void);
+
+// DMA requested by TX_REQ of Fmt, READY and dreq of UartTx
+extern Host_DmaCh DMA_Fmt_host;
+#define DMA_Fmt_DmaInitialize(burstCount, requestPerBurst, upperSrcAddress, upperDestAddress) \
+    Host_DmaInitialize(&DMA_Fmt_host, (burstCount), (requestPerBurst))
+
+// DMA requested by DONE of ACC, taken as the result FIFO not empty
+extern Host_DmaCh DMA_Result_host;
+#define DMA_Result_DmaInitialize(burstCount, requestPerBurst, upperSrcAddress, upperDestAddress) \
+    Host_DmaInitialize(&DMA_Result_host, (burstCount), (requestPerBurst))
+#endif
+
+#endif  // CY_HOST_PROJECT_H
+/* [] END OF FILE */